@@ -0,0 +1,40 @@
+/**
+ * \file bus_traffic.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Bus Traffic Accounting in Bytes
+ */
+
+#include "bus_traffic.h"
+#include <stdlib.h>
+
+bool parseTrafficParams(const char *text, trafficParams &params)
+{
+    uint *fields[] = {&params.cmdBytes, &params.wordBytes};
+    uint loop_f;
+    const char *p = text;
+
+    for(loop_f=0; (loop_f<sizeof(fields)/sizeof(fields[0])) && (*p != '\0'); loop_f++)
+    {
+        char *end;
+        unsigned long value = strtoul(p, &end, 10);
+
+        if((end == p) || (value > 65536))
+        {
+            return false;
+        }
+        *fields[loop_f] = (uint)value;
+
+        if(*end == ',')
+        {
+            end++;
+        }
+        else if(*end != '\0')
+        {
+            return false;
+        }
+        p = end;
+    }
+
+    return (*p == '\0');
+}
@@ -0,0 +1,47 @@
+/**
+ * \file bus_traffic.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Bus Traffic Accounting in Bytes
+ */
+
+#ifndef __BUS_TRAFFIC_H__
+#define __BUS_TRAFFIC_H__
+
+/** Type define unsigned int as uint */
+typedef unsigned int uint;
+
+/**
+ * \struct trafficParams
+ * \brief Bytes Charged to Each Part of a Bus Transaction
+ *
+ * Every command, including a writeback's, costs cmdBytes of control. A
+ * transaction that fetches a block or writes one back moves a block of
+ * data, and a Dragon update moves an update word.
+ */
+struct trafficParams
+{
+    uint cmdBytes;              /**< Command and Address Bytes of a Transaction */
+    uint wordBytes;             /**< Data Bytes of an Update Word */
+    bool report;                /**< Print the Traffic with the Metrics */
+
+    /**
+     * \brief trafficParams Constructor, Default Sizes
+     */
+    trafficParams()
+    {
+        cmdBytes = 8;
+        wordBytes = 4;
+        report = false;
+    }
+};
+
+/**
+ * \brief Parse "cmd,word" Sizes in Bytes, a Missing Trailing Field Keeps its Value
+ * \param[in] text Comma Separated Sizes
+ * \param[in,out] params Sizes
+ * \return Whether the Text was Valid
+ */
+bool parseTrafficParams(const char *text, trafficParams &params);
+
+#endif
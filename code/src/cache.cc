@@ -8,14 +8,15 @@
 #include "cache.h"
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
 
 using namespace std;
 
-Cache::Cache(int s,int a,int b)
+Cache::Cache(int s,int a,int b,enum replKind r, const cacheStore *shared)
 {
-    ulong i, j;
-    reads = readMisses = writes = 0; 
-    writeMisses = writeBacks = currentCycle = 0;
+    ulong i;
+    currentCycle = 0;
+    memset(counters, 0, sizeof(counters));
 
     size       = (ulong)(s);
     lineSize   = (ulong)(b);
@@ -25,9 +26,6 @@ Cache::Cache(int s,int a,int b)
     log2Sets   = (ulong)(log2(sets));   
     log2Blk    = (ulong)(log2(b));   
 
-    /** Initialized Coherence Counters */
-    cache2cache_tf = mem_transactions = num_interv = num_inval = num_flush = num_busrd = num_busrdx = num_busupd_upgr = 0;
-
     tagMask = 0;
     for(i=0;i<log2Sets;i++)
     {
@@ -35,16 +33,25 @@ Cache::Cache(int s,int a,int b)
         tagMask |= 1;
     }
 
-    /**create a two dimentional cache, sized as cache[sets][assoc]**/ 
-    cache = new cacheLine*[sets];
-    for(i=0; i<sets; i++)
+    if(shared != NULL)
     {
-        cache[i] = new cacheLine[assoc];
-        for(j=0; j<assoc; j++) 
-        {
-            cache[i][j].invalidate();
-        }
+        store = *shared;
+        storage = NULL;
+        storageBytes = 0;
     }
+    else
+    {
+        /** One Slab of Packed Lines, Zero Filled so Already Invalid, Committed a Page at a Time on First Touch */
+        storageBytes = numLines*sizeof(cacheLine);
+        storage = allocZeroPages(storageBytes);
+        store.lines = (cacheLine *)storage;
+        store.setStride = assoc;
+    }
+    
+    matchTag = getTagMatch(selectTagMatch(assoc));
+    
+    replacement = r;
+    repl = createReplPolicy(r, sets, assoc);
 }
 
 /** you might add other parameters to Access()
@@ -52,16 +59,16 @@ since this function is an entry point
 to the memory hierarchy (i.e. caches) */
 void Cache::Access(ulong addr,uchar op)
 {
-    currentCycle++;/*per cache global counter to maintain LRU order 
-                    among cache ways, updated on every cache access*/
+    currentCycle++;/*per cache access counter, 
+                    updated on every cache access*/
             
     if(op == 'w')
     {
-        writes++;
+        counters[CNT_WRITES]++;
     }
     else
     {
-        reads++;
+        counters[CNT_READS]++;
     }
 
     cacheLine * line = findLine(addr);
@@ -69,11 +76,11 @@ void Cache::Access(ulong addr,uchar op)
     {
         if(op == 'w')
         {
-            writeMisses++;
+            counters[CNT_WRITE_MISSES]++;
         }
         else
         {
-            readMisses++;
+            counters[CNT_READ_MISSES]++;
         }
 
         cacheLine *newline = fillLine(addr);
@@ -96,73 +103,46 @@ void Cache::Access(ulong addr,uchar op)
 /*look up line*/
 cacheLine * Cache::findLine(ulong addr)
 {
-    ulong i, j, tag, pos;
-
-    pos = assoc;
-    tag = calcTag(addr);
-    i   = calcIndex(addr);
+    cacheLine *ways = &store.lines[calcIndex(addr)*store.setStride];
 
-    for(j=0; j<assoc; j++)
-    {
-        if(cache[i][j].isValid())
-        {
-            if(cache[i][j].getTag() == tag)
-            {
-                pos = j; 
-                break; 
-            }
-        }
-    }
+    /** Invalid Lines Hold INVALID_LINE, so Matching the Tag Bits Alone Finds a Valid Line */
+    int way = matchTag((const ulong *)ways, assoc, lineKey(calcTag(addr)));
     
-    if(pos == assoc)
+    if(way < 0)
     {
         return NULL;
     }
     else
     {
-        return &(cache[i][pos]); 
+        return &ways[way]; 
     }
 }
 
-/*upgrade LRU line to be MRU line*/
-void Cache::updateLRU(cacheLine *line)
-{
-    line->setSeq(currentCycle);  
-}
-
-/*return an invalid line as LRU, if any, otherwise return LRU line*/
+/*return an invalid line as LRU, if any, otherwise return the policy's victim*/
 cacheLine * Cache::getLRU(ulong addr)
 {
-    ulong i, j, victim, min;
-
-    victim = assoc;
-    min    = currentCycle;
-    i      = calcIndex(addr);
+    ulong set = calcIndex(addr);
+    cacheLine *ways = &store.lines[set*store.setStride];
 
-    for(j=0;j<assoc;j++)
+    /** Lowest Numbered Invalid Way First */
+    int invalid = matchTag((const ulong *)ways, assoc, INVALID_LINE);
+    if(invalid >= 0)
     {
-        if(cache[i][j].isValid() == 0) 
-        {
-            return &(cache[i][j]);
-        }
-    }   
-    for(j=0;j<assoc;j++)
-    {
-        if(cache[i][j].getSeq() <= min) 
-        { 
-            victim = j; min = cache[i][j].getSeq();
-        }
-    } 
-    assert(victim != assoc);
+        return &ways[invalid];
+    }
+
+    ulong victim = repl->getVictim(set);
+    assert(victim < assoc);
 
-    return &(cache[i][victim]);
+    return &ways[victim];
 }
 
-/** Find a victim, move it to MRU position */
+/** Find a victim, record the fill with the replacement policy */
 cacheLine *Cache::findLineToReplace(ulong addr)
 {
+    ulong set = calcIndex(addr);
     cacheLine * victim = getLRU(addr);
-    updateLRU(victim);
+    repl->insert(set, victim - &store.lines[set*store.setStride]);
 
     return (victim);
 }
@@ -184,7 +164,28 @@ cacheLine *Cache::fillLine(ulong addr)
     victim->setTag(tag);
     victim->setFlags(VALID);    
     /**note that this cache line has been already 
-        upgraded to MRU in the previous function (findLineToReplace)**/
+        inserted in the previous function (findLineToReplace)**/
 
     return victim;
 }
+
+const char *getCounterName(enum cacheCounter c)
+{
+    static const char *names[NUM_CACHE_COUNTERS] = {"reads", "read_misses", "writes", "write_misses", "writebacks",
+                                                     "cache2cache", "mem_transactions", "interventions", "invalidations",
+                                                     "flushes", "busrd", "busrdx", "busupd_upgr", "control_bytes", "data_bytes"};
+    
+    return names[c];
+}
+
+/** Accumulate the counters of a cache simulating a disjoint slice of the trace */
+void Cache::addCounters(Cache *other)
+{
+    ulong loop_c;
+    
+    currentCycle += other->currentCycle;
+    for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+    {
+        counters[loop_c] += other->counters[loop_c];
+    }
+}
@@ -10,6 +10,11 @@
 
 #include <cmath>        /** Header for Standard Math Function Library */
 #include <iostream>     /** Header for I/O Stream Function Library */
+#include <stdlib.h>     /** Header for Standard Library Memory Allocation */
+
+#include "tag_match.h"
+#include "repl_policy.h"
+#include "zero_pages.h"
 
 /** Type define unsigned long as ulong */
 typedef unsigned long ulong;
@@ -26,22 +31,61 @@ enum cacheFlag  {
                     VALID =     1,  /**< Valid State - Used by All Protocols */
                     DIRTY =     2,  /**< Dirty State - Used by Generic Cache */
                     MODIFIED =  3,  /**< Modified State - Used by All Protocols */
-                    SHARED =    4,  /**< Shared State - Used by MSI & MESI Protocols */
-                    EXCLUSIVE = 5,  /**< Exclusive State - Used by MESI & Dragon Protocols */
+                    SHARED =    4,  /**< Shared State - Used by MSI, MESI, MOESI & MESIF Protocols */
+                    EXCLUSIVE = 5,  /**< Exclusive State - Used by MESI, MOESI, MESIF & Dragon Protocols */
                     SMODIFIED = 6,  /**< Shared Modified State - Used by Dragon Protocol */
-                    SCLEAN =    7   /**< Shared Clean State - Used by Dragon Protocol */
+                    SCLEAN =    7,  /**< Shared Clean State - Used by Dragon Protocol */
+                    OWNED =     8,  /**< Owned State, Dirty and Shared - Used by MOESI Protocol */
+                    FORWARD =   9   /**< Forward State, the Clean Supplier - Used by MESIF Protocol */
+};
+
+/** Number of Cache Block States */
+#define NUM_CACHE_FLAGS 10
+
+/** Cache Performance Counter Enumeration */
+enum cacheCounter   {
+                        CNT_READS =             0,  /**< Read Accesses */
+                        CNT_READ_MISSES =       1,  /**< Read Accesses that Miss */
+                        CNT_WRITES =            2,  /**< Write Accesses */
+                        CNT_WRITE_MISSES =      3,  /**< Write Accesses that Miss */
+                        CNT_WRITEBACKS =        4,  /**< Writebacks to the Lower Level of the Hierarchy */
+                        CNT_CACHE2CACHE =       5,  /**< Cache to Cache Transfers */
+                        CNT_MEM_TRANSACTIONS =  6,  /**< Transactions (R/W) with Memory */
+                        CNT_INTERVENTIONS =     7,  /**< Interventions */
+                        CNT_INVALIDATIONS =     8,  /**< Invalidations */
+                        CNT_FLUSHES =           9,  /**< Flushes Placed on the Bus */
+                        CNT_BUSRD =             10, /**< BusRd Commands Placed on the Bus */
+                        CNT_BUSRDX =            11, /**< BusRdX Commands Placed on the Bus */
+                        CNT_BUSUPD_UPGR =       12, /**< BusUpgr or BusUpd Commands Placed on the Bus */
+                        CNT_CTRL_BYTES =        13, /**< Command and Address Bytes Placed on the Bus */
+                        CNT_DATA_BYTES =        14, /**< Data Bytes Placed on the Bus */
+                        NUM_CACHE_COUNTERS =    15  /**< Number of Counters */
 };
 
+/** Event Mask Bit Incrementing a cacheCounter */
+#define EVENT(c) (1U << (c))
+
+/**
+ * \brief Get the Machine Readable Name of a Counter
+ * \param[in] c Counter
+ * \return Lower Case Name, as Used in Structured Output
+ */
+const char *getCounterName(enum cacheCounter c);
+
 /** 
  * \class cacheLine
- * \brief Class of a cache line 
+ * \brief One Line, its Tag and State Packed in a Single 64 Bit Word
+ *
+ * The inverted tag sits above the low LINE_STATE_BITS bits holding the
+ * cacheFlag, and an invalid line holds INVALID_LINE (zero), so a tag
+ * search compares the tag bits of the words alone and zero filled memory
+ * needs no initialisation. Replacement state lives in the cache's
+ * replPolicy, in per set arrays narrower than a word.
  */
 class cacheLine 
 {
 protected:
-    ulong tag;                  /**< Cache Line Tag */
-    enum cacheFlag Flags;       /**< Cache Line State Variable */
-    ulong seq;                  /**< Cache LRU Rank */
+    ulong word;                 /**< lineKey(Tag) | cacheFlag */
 
 public:
     
@@ -50,7 +94,7 @@ public:
      */
     cacheLine()                         
     { 
-        tag = 0; Flags = INVALID; 
+        word = INVALID_LINE; 
     }
     
     /**
@@ -59,7 +103,7 @@ public:
      */
     ulong getTag()                      
     { 
-        return tag; 
+        return ~word >> LINE_STATE_BITS; 
     }
     
     /**
@@ -68,44 +112,25 @@ public:
      */
     cacheFlag getFlags()                
     { 
-        return Flags; 
+        return (cacheFlag)(word & ~LINE_TAG_BITS); 
     }
     
     /**
-     * \brief Get Cache Line LRU Rank
-     * \return LRU Rank of the Cache Line
-     */
-    ulong getSeq()                      
-    { 
-        return seq;
-    }
-    
-    /**
-     * \brief Set Cache Line LRU Rank
-     * \param[in] Seq LRU Rank to Set
-     */
-    void setSeq(ulong Seq)              
-    { 
-        seq = Seq;
-    }
-    
-    
-    /**
-     * \brief Set Cache Line Flag
+     * \brief Set Cache Line Flag, an INVALID Line Stops Matching its Tag
      * \param[in] flags Flag to Set
      */
     void setFlags(cacheFlag flags)	
     { 
-        Flags = flags; 
+        word = (flags == INVALID) ? INVALID_LINE : ((word & LINE_TAG_BITS) | flags);
     }
     
     /**
-     * \brief Set Cache Tag
-     * \param[in] a Tag to Set
+     * \brief Set Cache Tag, the Line Matches Lookups of the Tag from Now On
+     * \param[in] a Tag to Set, Below 2^(64-LINE_STATE_BITS)
      */
     void setTag(ulong a)                
     { 
-        tag = a; 
+        word = lineKey(a) | (word & ~LINE_TAG_BITS); 
     }
     
     /**
@@ -113,8 +138,7 @@ public:
      */
     void invalidate()                   
     { 
-        tag = 0; 
-        Flags = INVALID; 
+        word = INVALID_LINE; 
     }
     
     /**
@@ -123,10 +147,31 @@ public:
      */
     bool isValid()                      
     { 
-        return ((Flags) != INVALID);
+        return ((word & ~LINE_TAG_BITS) != INVALID);
     }
 };
 
+static_assert(sizeof(cacheLine) == sizeof(ulong), "cacheLine Must Stay One Packed Word, the Tag Kernels Read the Slab as ulong");
+static_assert(NUM_CACHE_FLAGS <= (1 << LINE_STATE_BITS), "Every cacheFlag Must Fit the State Bits of a Line Word");
+
+/**
+ * \struct cacheStore
+ * \brief Slab Holding Every Line of a Cache
+ *
+ * Line j of set i is slot i*setStride+j, so the ways of a set are
+ * contiguous and a tag search reads assoc*8 bytes. A cache owning its slab
+ * has a stride of assoc; a cache viewing an interleaved layout owned by
+ * its controller has a stride of assoc times the processor count, its
+ * lines starting at its own ways of set 0. Slabs come from allocZeroPages,
+ * so they start out all invalid and only the pages of touched sets are
+ * ever committed.
+ */
+struct cacheStore
+{
+    cacheLine *lines;           /**< Packed Line per Slot */
+    ulong setStride;            /**< Slots from a Line to the Same Way of the Next Set */
+};
+
 /** 
  * \class Cache
  * \brief Class of a General Cache 
@@ -144,34 +189,14 @@ protected:
     ulong numLines;     /**< Number of Lines (Blocks) in Cache */
     ulong currentCycle; /**< Current Instruction Count */
     
-    /** Cache Performance Counters */
-    ulong reads;        /**< Number of Read Accesses to Cache */
-    ulong readMisses;   /**< Number of Read Accesses to Cache that Miss */
-    ulong writes;       /**< Number of Write Accesses to Cache */
-    ulong writeMisses;  /**< Number of Write Accesses to Cache that Miss */
-    ulong writeBacks;   /**< Number of Writebacks by the Cache to Lower Level in the Hierarchy */
-
-    /** Coherence Controller Performance Counters */
-    ulong cache2cache_tf;       /**< Number of Cache to Cache Transfers */
-    ulong mem_transactions;     /**< Number of Transactions (R/W) with Memory */
-    ulong num_interv;           /**< Number of Interventions in the Cache */
-    ulong num_inval;            /**< Number of Invalidations in the Cache */
-    ulong num_flush;            /**< Number of Flush Commands Placed on the Bus */
-    ulong num_busrd;            /**< Number of BusRd Commands Placed on the Bus */
-    ulong num_busrdx;           /**< Number of BusRdX Commands Placed on the Bus */
-    ulong num_busupd_upgr;      /**< Number of BusUpgr or BusUpd Commands Placed on the Bus */
+    ulong counters[NUM_CACHE_COUNTERS]; /**< Cache and Coherence Performance Counters, Indexed by cacheCounter */
 
-    cacheLine **cache;          /**< Pointer to a Pointer of cacheLine class object */
-    
-    /**
-     * \brief Calculate Index from the CPU Access Address
-     * \param[in] addr Access Address from CPU
-     * \return Index of the Access Address according to Cache Organization
-     */
-    ulong calcIndex(ulong addr)     
-    { 
-        return ((addr >> log2Blk) & tagMask); 
-    }
+    cacheStore store;           /**< Slab of All Lines */
+    void *storage;              /**< Zero Pages Backing the Slab, NULL for a View of a Shared Slab */
+    ulong storageBytes;         /**< Size of storage */
+    tagMatchFn matchTag;        /**< Tag Search Kernel for the Associativity and Host */
+    replPolicy *repl;           /**< Replacement State of Every Set */
+    enum replKind replacement;  /**< Replacement Policy Kind */
     
     /**
      * \brief Calculate Full Block Aligned Address from Tag
@@ -190,15 +215,18 @@ public:
      * \param[in] s Cache Size
      * \param[in] a Cache Line/Block Size
      * \param[in] b Cache Associativity
+     * \param[in] r Replacement Policy
+     * \param[in] shared Slab Owned by the Caller, Outliving the Cache, NULL to Allocate a Private One
      */
-    Cache(int s,int a,int b);
+    Cache(int s,int a,int b,enum replKind r = REPL_LRU, const cacheStore *shared = NULL);
     
     /**
      * \brief Cache Class Destructor
      */
     ~Cache() 
     { 
-        delete cache; 
+        freeZeroPages(storage, storageBytes);
+        delete repl;
     }
 
     /**
@@ -222,6 +250,24 @@ public:
      */
     cacheLine *findLine(ulong addr);
     
+    /**
+     * \brief Choose the Tag Search Kernel Used by findLine
+     * \param[in] kind Kernel, Must be tagMatchSupported for this Associativity
+     */
+    void setTagMatch(enum tagMatchKind kind)
+    {
+        matchTag = getTagMatch(kind);
+    }
+    
+    /**
+     * \brief Get the Replacement Policy
+     * \return Replacement Policy Kind
+     */
+    enum replKind getReplacement()
+    {
+        return replacement;
+    }
+    
     /**
      * \brief Get Cache Line to be Evicted in a Particular Set
      * \param[in] addr CPU Access Address
@@ -246,7 +292,7 @@ public:
      */
     ulong getReads()            
     { 
-        return reads;
+        return counters[CNT_READS];
     }
     
     /**
@@ -255,7 +301,7 @@ public:
      */
     ulong getRM()               
     { 
-        return readMisses; 
+        return counters[CNT_READ_MISSES]; 
     } 
     /**
      * \brief Get Writes Counter
@@ -263,7 +309,7 @@ public:
      */
     ulong getWrites()           
     { 
-        return writes; 
+        return counters[CNT_WRITES]; 
     }
     
     /**
@@ -272,7 +318,7 @@ public:
      */
     ulong getWM()               
     { 
-        return writeMisses; 
+        return counters[CNT_WRITE_MISSES]; 
     } 
     
     /**
@@ -281,7 +327,7 @@ public:
      */
     ulong getWB()               
     { 
-        return writeBacks;
+        return counters[CNT_WRITEBACKS];
     }
     
     /**
@@ -290,7 +336,7 @@ public:
      */
     ulong getCache2cache()      
     { 
-        return cache2cache_tf; 
+        return counters[CNT_CACHE2CACHE]; 
     }
     
     /**
@@ -299,7 +345,7 @@ public:
      */
     ulong getMemtransactions()  
     { 
-        return mem_transactions; 
+        return counters[CNT_MEM_TRANSACTIONS]; 
     }
     
     /**
@@ -308,7 +354,7 @@ public:
      */
     ulong getInterv()           
     { 
-        return num_interv;
+        return counters[CNT_INTERVENTIONS];
     }
     
     /**
@@ -317,7 +363,7 @@ public:
      */
     ulong getInval()            
     { 
-        return num_inval;
+        return counters[CNT_INVALIDATIONS];
     }
     
     /**
@@ -326,7 +372,7 @@ public:
      */
     ulong getFlush()            
     { 
-        return num_flush;
+        return counters[CNT_FLUSHES];
     }
     
     /**
@@ -335,7 +381,7 @@ public:
      */
     ulong getBusrd()           
     { 
-        return num_busrd; 
+        return counters[CNT_BUSRD]; 
     }
     
     /**
@@ -344,7 +390,7 @@ public:
      */
     ulong getBusrdx()           
     { 
-        return num_busrdx; 
+        return counters[CNT_BUSRDX]; 
     }
     
     /**
@@ -353,7 +399,44 @@ public:
      */
     ulong getBusupdupgr()       
     { 
-        return num_busupd_upgr;
+        return counters[CNT_BUSUPD_UPGR];
+    }
+    
+    /**
+     * \brief Get Any Counter
+     * \param[in] c Counter
+     * \return Counter Value
+     */
+    ulong getCounter(enum cacheCounter c)
+    {
+        return counters[c];
+    }
+    
+    /**
+     * \brief Get Bus Control Bytes Counter
+     * \return Command and Address Bytes this Cache Placed on the Bus
+     */
+    ulong getCtrlBytes()
+    {
+        return counters[CNT_CTRL_BYTES];
+    }
+    
+    /**
+     * \brief Get Bus Data Bytes Counter
+     * \return Data Bytes Moved on the Bus for this Cache
+     */
+    ulong getDataBytes()
+    {
+        return counters[CNT_DATA_BYTES];
+    }
+    
+    /**
+     * \brief Get Block Size
+     * \return Cache Block Size in Bytes
+     */
+    ulong getLineSize()
+    {
+        return lineSize;
     }
     
     /** Update Functions */
@@ -371,7 +454,7 @@ public:
      */
     void incReads()            
     { 
-        reads++; 
+        counters[CNT_READS]++; 
     }
     
     /**
@@ -379,7 +462,7 @@ public:
      */
     void incRM()               
     { 
-        readMisses++;
+        counters[CNT_READ_MISSES]++;
     } 
     
     /**
@@ -387,7 +470,7 @@ public:
      */
     void incWrites()           
     { 
-        writes++;
+        counters[CNT_WRITES]++;
     }
     
     /**
@@ -395,7 +478,7 @@ public:
      */
     void incWM()               
     { 
-        writeMisses++;
+        counters[CNT_WRITE_MISSES]++;
     } 
     
     /**
@@ -403,7 +486,7 @@ public:
      */
     void incWB()               
     { 
-        writeBacks++; 
+        counters[CNT_WRITEBACKS]++; 
     }
     
     /**
@@ -412,7 +495,7 @@ public:
      */
     void writeBack(ulong addr)       
     { 
-        writeBacks++; 
+        counters[CNT_WRITEBACKS]++; 
     }
     
     /**
@@ -420,7 +503,7 @@ public:
      */
     void incCache2cache()      
     { 
-        cache2cache_tf++; 
+        counters[CNT_CACHE2CACHE]++; 
     }
     
     /**
@@ -428,7 +511,7 @@ public:
      */
     void incMemtransactions()  
     { 
-        mem_transactions++;
+        counters[CNT_MEM_TRANSACTIONS]++;
     }
     
     /**
@@ -436,7 +519,7 @@ public:
      */
     void incInterv()           
     { 
-        num_interv++; 
+        counters[CNT_INTERVENTIONS]++; 
     }
     
     /**
@@ -444,7 +527,7 @@ public:
      */
     void incInval()            
     { 
-        num_inval++; 
+        counters[CNT_INVALIDATIONS]++; 
     }
     
     /**
@@ -452,7 +535,7 @@ public:
      */
     void incFlush()            
     { 
-        num_flush++;
+        counters[CNT_FLUSHES]++;
     }
     
     /**
@@ -460,7 +543,7 @@ public:
      */
     void incBusrd()           
     { 
-        num_busrd++; 
+        counters[CNT_BUSRD]++; 
     }
     
     /**
@@ -468,7 +551,7 @@ public:
      */
     void incBusrdx()           
     { 
-        num_busrdx++; 
+        counters[CNT_BUSRDX]++; 
     }
     
     /**
@@ -476,14 +559,43 @@ public:
      */
     void incBusupdupgr()       
     { 
-        num_busupd_upgr++;
+        counters[CNT_BUSUPD_UPGR]++;
     }
     
     /**
-     * \brief Update LRU of a Cache Line
+     * \brief Charge Bus Traffic to the Cache
+     * \param[in] ctrlBytes Command and Address Bytes
+     * \param[in] dataBytes Data Bytes
+     */
+    void addTraffic(ulong ctrlBytes, ulong dataBytes)
+    {
+        counters[CNT_CTRL_BYTES] += ctrlBytes;
+        counters[CNT_DATA_BYTES] += dataBytes;
+    }
+    
+    /**
+     * \brief Increment Every Counter Named in an Event Mask
+     * \param[in] events OR of EVENT(cacheCounter) Bits
+     */
+    void addEvents(uint events)
+    {
+        while(events != 0)
+        {
+            counters[__builtin_ctz(events)]++;
+            events &= events - 1;
+        }
+    }
+    
+    /**
+     * \brief Record a Hit on a Cache Line with the Replacement Policy
      * \param[in] line Pointer to a Cache Line
      */
-    void updateLRU(cacheLine *line);
+    void updateLRU(cacheLine *line)
+    {
+        /** The Low Bits of the Tag are the Set Index */
+        ulong set = line->getTag() & tagMask;
+        repl->touch(set, line - &store.lines[set*store.setStride]);
+    }
     
     /**
      * \brief Cache Access Routine
@@ -492,6 +604,22 @@ public:
      */
     void Access(ulong addr,uchar op);
     
+    /**
+     * \brief Add Another Cache's Performance Counters to this Cache's
+     * \param[in] other Cache Whose Counters are Added
+     */
+    void addCounters(Cache *other);
+    
+    /**
+     * \brief Calculate Index from the CPU Access Address
+     * \param[in] addr Access Address from CPU
+     * \return Index of the Access Address according to Cache Organization
+     */
+    ulong calcIndex(ulong addr)     
+    { 
+        return ((addr >> log2Blk) & tagMask); 
+    }
+    
     /**
      * \brief Calculate Tag from the CPU Access Address
      * \param[in] addr Access Address from CPU
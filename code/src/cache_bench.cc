@@ -0,0 +1,146 @@
+/**
+ * \file cache_bench.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Cache Tag Lookup Microbenchmark (Scalar vs SIMD findLine)
+ *
+ * Fills a cache, then times the same stream of lookups, half hits and half
+ * misses, through Cache::findLine with every tag search kernel the host
+ * supports at associativity 4, 8 and 16.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <vector>
+
+#include "cache.h"
+
+using namespace std;
+
+/** Block Size of the Benchmarked Caches */
+#define BENCH_BLOCK 64
+
+/**
+ * \brief Wall Clock Time
+ * \return Seconds Since the Epoch
+ */
+static double wallTime()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec*1e-6;
+}
+
+/**
+ * \brief Time a Lookup Stream Through findLine
+ * \param[in] cache Filled Cache
+ * \param[in] addrs Addresses to Look Up
+ * \param[in] passes Times the Stream is Replayed
+ * \param[out] checksum Checksum of the Lookup Results
+ * \return Seconds Taken
+ */
+static double benchLookups(Cache &cache, const vector<ulong> &addrs, int passes, ulong *checksum)
+{
+    ulong sum = 0, loop_a;
+    int loop_p;
+    double start = wallTime();
+
+    for(loop_p=0; loop_p<passes; loop_p++)
+    {
+        for(loop_a=0; loop_a<addrs.size(); loop_a++)
+        {
+            cacheLine *line = cache.findLine(addrs[loop_a]);
+            sum += (line != NULL) ? line->getTag() : 1;
+        }
+    }
+
+    *checksum = sum;
+    return wallTime() - start;
+}
+
+int main(int argc, char *argv[])
+{
+    ulong numLookups = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    int cacheSize = (argc > 2) ? atoi(argv[2]) : 262144;
+    int passes = (argc > 3) ? atoi(argv[3]) : 20;
+    const int assocs[] = {4, 8, 16};
+    const enum tagMatchKind kinds[] = {TAG_MATCH_SCALAR, TAG_MATCH_SSE41, TAG_MATCH_AVX2};
+    int rc = 0;
+    ulong loop_k;
+
+    if((numLookups == 0) || (passes < 1) || (cacheSize < BENCH_BLOCK*16))
+    {
+        printf("input format: ");
+        printf("./cache_bench [lookups] [cache_size] [passes] \n");
+        exit(0);
+    }
+
+    printf("===== Cache tag lookup benchmark =====\n");
+    printf("CACHE SIZE: %d\n", cacheSize);
+    printf("BLOCK SIZE: %d\n", BENCH_BLOCK);
+    printf("LOOKUPS: %lu x %d passes, 50%% hits\n", numLookups, passes);
+
+    for(loop_k=0; loop_k<sizeof(assocs)/sizeof(assocs[0]); loop_k++)
+    {
+        int assoc = assocs[loop_k];
+        Cache cache(cacheSize, assoc, BENCH_BLOCK);
+        ulong numLines = cacheSize/BENCH_BLOCK;
+        ulong loop_a;
+
+        /** Consecutive Blocks Fill Every Way of Every Set */
+        for(loop_a=0; loop_a<numLines; loop_a++)
+        {
+            cache.fillLine(loop_a*BENCH_BLOCK);
+        }
+
+        /** Hits Name a Resident Block, Misses a Block Mapping to the Same Sets */
+        vector<ulong> addrs(numLookups);
+        srand(506);
+        for(loop_a=0; loop_a<numLookups; loop_a++)
+        {
+            ulong block = (ulong)rand() % numLines;
+            if(loop_a & 1)
+            {
+                block += numLines*(1 + (ulong)rand() % 15);
+            }
+            addrs[loop_a] = block*BENCH_BLOCK;
+        }
+
+        double timeScalar = 0.0;
+        ulong sumScalar = 0;
+        ulong loop_m;
+
+        for(loop_m=0; loop_m<sizeof(kinds)/sizeof(kinds[0]); loop_m++)
+        {
+            if(!tagMatchSupported(kinds[loop_m], assoc))
+            {
+                printf("assoc %2d\t%-7s\tnot supported on this host\n", assoc, getTagMatchName(kinds[loop_m]));
+                continue;
+            }
+
+            ulong sum;
+            cache.setTagMatch(kinds[loop_m]);
+            double seconds = benchLookups(cache, addrs, passes, &sum);
+            double lookups = (double)numLookups*passes;
+
+            if(kinds[loop_m] == TAG_MATCH_SCALAR)
+            {
+                timeScalar = seconds;
+                sumScalar = sum;
+            }
+
+            printf("assoc %2d\t%-7s\t%.2f ns/lookup\t%.0f lookups/sec\tspeedup vs scalar %.2fx\n",
+                   assoc, getTagMatchName(kinds[loop_m]), seconds*1e9/lookups, lookups/seconds, timeScalar/seconds);
+
+            if(sum != sumScalar)
+            {
+                printf("MISMATCH: %s disagrees with the scalar lookup\n", getTagMatchName(kinds[loop_m]));
+                rc = 1;
+            }
+        }
+        printf("assoc %2d\tdefault: %s\n", assoc, getTagMatchName(selectTagMatch(assoc)));
+    }
+
+    return rc;
+}
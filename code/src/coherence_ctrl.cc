@@ -10,880 +10,417 @@
 #include "coherence_ctrl.h"
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
-#define RD_REQ 0
-#define WR_REQ 1
-
-coherenceController::coherenceController(int s, int a, int b, int numP, enum coh_protocol cohProtocol)
+const char *getProtocolName(enum coh_protocol cohProtocol)
 {
-    num_processors = numP;
-    coherenceProtocol = cohProtocol;
-    busControl = 0xFF;
-    busValid = VALID_BUS;
-    busAddr = 0;
-    busData = 0;
-    copiesExist = NCEX;
-    busCommand = INVALID_BUS;
-    hitMiss = MISS;
-    
-    cacheOnbus = new Cache*[numP];
-    
-    uchar loop_i;
-    for(loop_i=0;loop_i<numP;loop_i++)
+    switch(cohProtocol)
     {
-        cacheOnbus[loop_i] = new Cache(s, a, b);
+        case MSI:       return "MSI";
+        case MESI:      return "MESI";
+        case DRAGON:    return "Dragon";
+        case MOESI:     return "MOESI";
+        case MESIF:     return "MESIF";
     }
+    
+    return "UNKNOWN";
 }
 
-void coherenceController::processRequest(ulong procNum, uchar rdWr, ulong reqAddr)
+bool parseTagLayout(const char *name, enum tagLayout &layout)
 {
-    switch(coherenceProtocol)
+    if(strcmp(name, "private") == 0)
     {
-        case MSI:   processMSI(procNum, rdWr, reqAddr);
-                    break;
-                    
-        case MESI:  processMESI(procNum, rdWr, reqAddr);
-                    break;
-                    
-        case DRAGON:    processDRAGON(procNum, rdWr, reqAddr);
-                        break;
+        layout = LAYOUT_PRIVATE;
     }
-}
-
-void coherenceController::processMSI(ulong procNum, uchar rdWr, ulong reqAddr)
-{
-    /** Increment the Cache's Request Count */
-    cacheOnbus[procNum]->inccurrentCycle();
-    
-    /** Pointer to Cache Line to Update Finally */
-    cacheLine *line;
-    
-    /** Check Type of Read and Update Counter */
-    if(rdWr==RD_REQ)
+    else if(strcmp(name, "interleaved") == 0)
     {
-        cacheOnbus[procNum]->incReads();
+        layout = LAYOUT_INTERLEAVED;
     }
     else
     {
-        cacheOnbus[procNum]->incWrites();
+        return false;
     }
     
-    /** Look for the Requested Address in the Cache */
-    line = cacheOnbus[procNum]->findLine(reqAddr);
-    
-    /** If Cache Line Not Found */
-    if(line==NULL)
-    {
-        /** Set To Miss */
-        hitMiss = MISS;
-        
-        /** Fetch a Victim Cache Line for the Data */
-        cacheLine *victim = cacheOnbus[procNum]->findLineToReplace(reqAddr);
-        assert(victim != 0);
-        
-        /** Store Victim Block to the Cache Line to Update Pointer */
-        line = victim;
-        
-        if(victim->getFlags()==MODIFIED)
-        {
-            /** Update Writeback Counter */
-            cacheOnbus[procNum]->incWB();
-            
-            /** Update Memory Transaction Counter */
-            cacheOnbus[procNum]->incMemtransactions();
-        }
-        
-        /* Bus in Control of Current Processor */
-        busControl = procNum;
-        
-        /* Bus Signals are Valid */
-        busValid = VALID_BUS;
-        
-        /* Place Required Address on the Bus */
-        busAddr = reqAddr;
-        
-        if(rdWr==RD_REQ)
-        {
-            /** Update Read Miss Counters */
-            cacheOnbus[procNum]->incRM();
-            
-            /** Place BusRd Command on Bus */
-            busCommand = BUSRD;
-            
-            /** Update BusRd Counter */
-            cacheOnbus[procNum]->incBusrd();
-        }
-        else
-        {
-            /** Update Write Miss Counters */
-            cacheOnbus[procNum]->incWM();
-            
-            /** Place BusRdX Command on Bus */
-            busCommand = BUSRDX;
-            
-            /** Update BusRdX Counter */
-            cacheOnbus[procNum]->incBusrdx();
-        }
-    }
-    else
+    return true;
+}
+
+const char *getTagLayoutName(enum tagLayout layout)
+{
+    switch(layout)
     {
-        /** Set To Hit */
-        hitMiss = HIT;
-        
-        /** If Hit Cache Line in Shared State and a Write is Required */
-        if((line->getFlags()==SHARED)&&(rdWr==WR_REQ))
-        {
-            /* Bus in Control of Current Processor */
-            busControl = procNum;
-            
-            /* Bus Signals are Valid */
-            busValid = VALID_BUS;
-            
-            /* Place Required Address on the Bus */
-            busAddr = reqAddr;
-            
-            /** Place BusRdX Command on Bus */
-            busCommand = BUSRDX;
-            
-            /** Update BusRdX Counter */
-            cacheOnbus[procNum]->incBusrdx();
-        }
+        case LAYOUT_PRIVATE:        return "private";
+        case LAYOUT_INTERLEAVED:    return "interleaved";
     }
     
-    /* Perform Bus Snooping Operations */
-    if(busValid==VALID_BUS)
-    {
-        uchar loop_i;
-        
-        switch(busCommand)
-        {
-            case BUSRD: cacheOnbus[procNum]->incMemtransactions();
-                        for(loop_i=0; loop_i<num_processors; loop_i++)
-                        {
-                            /** Look for the Request Address in the Cache */
-                            cacheLine *line_procn = cacheOnbus[loop_i]->findLine(busAddr);
-                            
-                            /** If Found in Cache Other than Cache Serivicing the Request */
-                            if((line_procn!=NULL)&&(loop_i!=procNum)&&(line_procn->getFlags()==MODIFIED))
-                            {
-                                /** Set Cache Line State To Shared */
-                                line_procn->setFlags(SHARED);
-                                
-                                /** Update Intervention Counter */
-                                cacheOnbus[loop_i]->incInterv();
-                                
-                                /** Update Flush Counter */
-                                cacheOnbus[loop_i]->incFlush();
-                                
-                                /** Flush Constitutes as a Memory Transaction */
-                                cacheOnbus[loop_i]->incMemtransactions();
-                                
-                                /** Flush Constitutes as a Writeback */
-                                cacheOnbus[loop_i]->incWB();
-                                
-                                busControl = loop_i;
-                                busCommand = FLUSH;
-                            }
-                        }
-                        break;
-                        
-            case BUSRDX:    cacheOnbus[procNum]->incMemtransactions();
-                            for(loop_i=0; loop_i<num_processors; loop_i++)
-                            {
-                                /** Look for the Request Address in the Cache */
-                                cacheLine *line_proc = cacheOnbus[loop_i]->findLine(busAddr);
-                                
-                                /** If Found in Cache Other than Cache Serivicing the Request */
-                                if((line_proc!=NULL)&&(loop_i!=procNum))
-                                {
-                                    /** Update Invalidation Counter */
-                                    cacheOnbus[loop_i]->incInval();
-                                    
-                                    /** If Modified */
-                                    if(line_proc->getFlags()==MODIFIED)
-                                    {
-                                        /** Update Flush Counter */
-                                        cacheOnbus[loop_i]->incFlush();
-                                        
-                                        /** Flush Constitutes as a Memory Transaction */
-                                        cacheOnbus[loop_i]->incMemtransactions();
-                                        
-                                        /** Flush Constitutes as a Writeback */
-                                        cacheOnbus[loop_i]->incWB();
-                                        
-                                        busControl = loop_i;
-                                        busCommand = FLUSH;
-                                    }
-                                    
-                                    /** Invalidate Cache Line */
-                                    line_proc->invalidate();
-                                }
-                            }
-                            break;
-            
-            default:    printf("ERROR\n");
-                        break;
-        }
-    }
+    return "UNKNOWN";
+}
+
+coherenceController::coherenceController(int s, int a, int b, int numP, enum coh_protocol cohProtocol, enum replKind repl, enum tagLayout lay)
+{
+    num_processors = numP;
+    coherenceProtocol = cohProtocol;
+    cacheOnbus = new Cache*[numP];
     
-    /** Perform Finishing Actions */
-    if(hitMiss==HIT)
+    timing = NULL;
+    sampler = NULL;
+    profiler = NULL;
+    directory = NULL;
+    busTransactions = 0;
+    layout = lay;
+    assoc = (ulong)a;
+    layoutStorage = NULL;
+    layoutBytes = 0;
+    snoopWords = ((ulong)numP + SHARER_WORD_BITS - 1)/SHARER_WORD_BITS;
+    snoopScratch = new ulong[snoopWords];
+    
+    int loop_i;
+    if(layout == LAYOUT_INTERLEAVED)
     {
-        cacheOnbus[procNum]->updateLRU(line);
-        
-        if(rdWr==WR_REQ)
+        /** Set S of Processor p Starts at Slot (S*numP + p)*assoc, Zero Pages so Every Line Starts Invalid */
+        layoutBytes = (ulong)(s/b)*numP*sizeof(cacheLine);
+        layoutStorage = allocZeroPages(layoutBytes);
+        interleaved.lines = (cacheLine *)layoutStorage;
+        interleaved.setStride = assoc*numP;
+        scanTags = getTagScan(selectTagScan());
+        sharers = NULL;
+        
+        for(loop_i=0; loop_i<numP; loop_i++)
         {
-            line->setFlags(MODIFIED);
+            cacheStore view = interleaved;
+            view.lines += loop_i*assoc;
+            cacheOnbus[loop_i] = new Cache(s, a, b, repl, &view);
         }
     }
     else
     {
-        ulong tag;
-        tag = cacheOnbus[procNum]->calcTag(reqAddr);
-        line->setTag(tag);
+        interleaved.lines = NULL;
+        interleaved.setStride = 0;
+        scanTags = NULL;
+        sharers = new sharerDirectory(numP);
         
-        cacheOnbus[procNum]->updateLRU(line);
-        
-        if(rdWr==WR_REQ)
-        {
-            line->setFlags(MODIFIED);
-        }
-        else
+        for(loop_i=0; loop_i<numP; loop_i++)
         {
-            line->setFlags(SHARED);
+            cacheOnbus[loop_i] = new Cache(s, a, b, repl);
         }
     }
-    
-    /** Reset Bus */
-    busControl = 0xFF;
-    busValid = INVALID_BUS;
-    busAddr = 0xFFFFFFFF;
-    busCommand = INVALID_BUS;
-    
-    hitMiss = RST_OUT;
 }
 
-void coherenceController::processMESI(ulong procNum, uchar rdWr, ulong reqAddr)
+template<class Policy>
+void coherenceController::processTable(ulong procNum, uchar rdWr, ulong reqAddr)
 {
+    const protocolTable &table = Policy::table;
+    Cache *cache = cacheOnbus[procNum];
+    
     /** Increment the Cache's Request Count */
-    cacheOnbus[procNum]->inccurrentCycle();
+    cache->inccurrentCycle();
     
-    /** Pointer to Cache Line to Update Finally */
-    cacheLine *line;
+    /** Look for the Requested Address in the Cache */
+    cacheLine *line = cache->findLine(reqAddr);
+    bool miss = (line == NULL);
+    uchar state = INVALID;
+    uint victimEvents = 0;
     
-    /** Check Type of Read and Update Counter */
-    if(rdWr==RD_REQ)
+    if(miss)
     {
-        cacheOnbus[procNum]->incReads();
+        /** Fetch a Victim Cache Line for the Data */
+        line = cache->findLineToReplace(reqAddr);
+        assert(line != 0);
+        
+        /** Victim Block Leaves the Cache */
+        if(line->isValid())
+        {
+            if(sharers != NULL)
+            {
+                sharers->remove(line->getTag(), procNum);
+            }
+            victimEvents = table.evict[line->getFlags()];
+            cache->addEvents(victimEvents);
+            if(directory != NULL)
+            {
+                directory->evicted(line->getTag(), procNum, (victimEvents & EVENT(CNT_WRITEBACKS)) != 0);
+            }
+        }
     }
     else
     {
-        cacheOnbus[procNum]->incWrites();
+        state = line->getFlags();
+        cache->updateLRU(line);
     }
     
-    /** Look for the Requested Address in the Cache */
-    line = cacheOnbus[procNum]->findLine(reqAddr);
+    /** Any Non Zero rdWr is a Write, as in the Trace Decoder */
+    const procTransition &request = table.proc[state][rdWr != PROC_RD];
+    cache->addEvents(request.events);
     
-    /** If Cache Line Not Found */
-    if(line==NULL)
+    uint signal = 0;
+    uint busEvents = 0;
+    
+    /* Perform Bus Snooping Operations */
+    if(request.busCommand != INVALID_BUS)
     {
-        /** Set To Miss */
-        hitMiss = MISS;
+        const busActions &bus = table.bus[request.busCommand];
+        const snoopTransition *snoop = table.snoop[request.busCommand];
+        busEvents = bus.before;
+        busTransactions++;
         
-        /** Fetch a Victim Cache Line for the Data */
-        cacheLine *victim = cacheOnbus[procNum]->findLineToReplace(reqAddr);
-        assert(victim != 0);
+        if(profiler != NULL)
+        {
+            profiler->begin(reqAddr & ~(cache->getLineSize() - 1), procNum, rdWr != PROC_RD, bus.word);
+        }
         
-        /** Store Victim Block to the Cache Line to Update Pointer */
-        line = victim;
+        /** Only Caches Holding the Block are Snooped, in Ascending Processor Order */
+        int loop_i;
+        ulong copies = 0;
+        long dirtyHolder = -1;
+        bool revision = false;
+        sharerIterator peers = snoopPeers(procNum, reqAddr);
         
-        if(victim->getFlags()==MODIFIED)
+        while((loop_i = peers.next()) >= 0)
         {
-            /** Update Writeback Counter */
-            cacheOnbus[procNum]->incWB();
+            /** Look for the Request Address in the Cache */
+            cacheLine *line_procn = cacheOnbus[loop_i]->findLine(reqAddr);
             
-            /** Update Memory Transaction Counter */
-            cacheOnbus[procNum]->incMemtransactions();
+            if(line_procn != NULL)
+            {
+                const snoopTransition &response = snoop[line_procn->getFlags()];
+                copies++;
+                cacheOnbus[loop_i]->addEvents(response.events);
+                signal |= response.signal;
+                
+                /** A Copy that Would be Written Back was Written by its Holder */
+                if(profiler != NULL)
+                {
+                    profiler->snooped(loop_i, (table.evict[line_procn->getFlags()] & EVENT(CNT_WRITEBACKS)) != 0,
+                                      (response.events & EVENT(CNT_INVALIDATIONS)) != 0, (response.events & EVENT(CNT_INTERVENTIONS)) != 0);
+                }
+                
+                if(response.next == INVALID)
+                {
+                    /** Invalidate Cache Line */
+                    line_procn->invalidate();
+                    if(sharers != NULL)
+                    {
+                        sharers->remove(cacheOnbus[loop_i]->calcTag(reqAddr), loop_i);
+                    }
+                }
+                else
+                {
+                    line_procn->setFlags((enum cacheFlag)response.next);
+                    if(table.evict[response.next] & EVENT(CNT_WRITEBACKS))
+                    {
+                        dirtyHolder = loop_i;
+                    }
+                }
+                revision |= (response.events & EVENT(CNT_WRITEBACKS)) != 0;
+            }
         }
         
-        /* Bus in Control of Current Processor */
-        busControl = procNum;
-        
-        /* Bus Signals are Valid */
-        busValid = VALID_BUS;
+        busEvents |= ((signal & SNOOP_SUPPLY) == SNOOP_SUPPLY) ? bus.cache : bus.memory;
+        cache->addEvents(busEvents);
         
-        /* Place Required Address on the Bus */
-        busAddr = reqAddr;
-        
-        if(rdWr==RD_REQ)
+        if(profiler != NULL)
         {
-            /** Update Read Miss Counters */
-            cacheOnbus[procNum]->incRM();
-            
-            /** Place BusRd Command on Bus */
-            busCommand = BUSRD;
-            
-            /** Update BusRd Counter */
-            cacheOnbus[procNum]->incBusrd();
+            profiler->end((busEvents & EVENT(CNT_CACHE2CACHE)) != 0);
         }
-        else
+        
+        if(directory != NULL)
         {
-            /** Update Write Miss Counters */
-            cacheOnbus[procNum]->incWM();
+            /** A State Written Without a Request Means the Requester Was Granted the Only Copy */
+            uchar granted = request.next[signal & SNOOP_COPY];
+            bool exclusive = (granted != INVALID) && (table.proc[granted][PROC_WR].busCommand == INVALID_BUS);
+            long recall = directory->request(cache->calcTag(reqAddr), procNum, invalidatesCopies(table, request.busCommand), bus.word,
+                                             miss, exclusive, copies, dirtyHolder, revision);
             
-            /** Place BusRdX Command on Bus */
-            busCommand = BUSRDX;
-            
-            /** Update BusRdX Counter */
-            cacheOnbus[procNum]->incBusrdx();
+            /** A Dir_i_NB Entry Freed a Pointer, its Sharer's Copy is Invalidated as if Evicted */
+            if(recall >= 0)
+            {
+                Cache *holder = cacheOnbus[recall];
+                cacheLine *copy = holder->findLine(reqAddr);
+                assert(copy != NULL);
+                uint recallEvents = table.evict[copy->getFlags()];
+                holder->addEvents(recallEvents | EVENT(CNT_INVALIDATIONS));
+                directory->recalled((recallEvents & EVENT(CNT_WRITEBACKS)) != 0);
+                copy->invalidate();
+                if(sharers != NULL)
+                {
+                    sharers->remove(holder->calcTag(reqAddr), recall);
+                }
+            }
         }
-    }
-    else
-    {
-        /** Set To Hit */
-        hitMiss = HIT;
         
-        /** If Hit Cache Line in Shared State and a Write is Required */
-        if((line->getFlags()==SHARED)&&(rdWr==WR_REQ))
+        /** A Block Moves Whenever a Cache or Memory Supplied One */
+        ulong dataBytes = (busEvents & (EVENT(CNT_CACHE2CACHE) | EVENT(CNT_MEM_TRANSACTIONS))) ? cache->getLineSize() : 0;
+        if(bus.word)
         {
-            /* Bus in Control of Current Processor */
-            busControl = procNum;
-            
-            /* Bus Signals are Valid */
-            busValid = VALID_BUS;
-            
-            /* Place Required Address on the Bus */
-            busAddr = reqAddr;
-            
-            /** Place BusRdX Command on Bus */
-            busCommand = BUSUPGR;
-            
-            /** Update BusRdX Counter */
-            cacheOnbus[procNum]->incBusupdupgr();
+            dataBytes += traffic.wordBytes;
         }
+        cache->addTraffic(traffic.cmdBytes, dataBytes);
     }
     
-    /* Perform Bus Snooping Operations */
-    if(busValid==VALID_BUS)
+    /** A Writeback is a Command Carrying the Victim Block */
+    if(victimEvents & EVENT(CNT_WRITEBACKS))
     {
-        uchar loop_i;
-        
-        switch(busCommand)
-        {
-            case BUSRD: for(loop_i=0; loop_i<num_processors; loop_i++)
-                        {
-                            /** Look for the Request Address in the Cache */
-                            cacheLine *line_procn = cacheOnbus[loop_i]->findLine(busAddr);
-                            
-                            /** If Found in Cache Other than Cache Serivicing the Request */
-                            if((line_procn!=NULL)&&(loop_i!=procNum))
-                            {
-                                /** Copies Exist */
-                                copiesExist = CEX;
-                                
-                                switch(line_procn->getFlags())
-                                {
-                                    case MODIFIED:  /** Update Flush Counter */
-                                                    cacheOnbus[loop_i]->incFlush();
-                                                    
-                                                    /** Flush Constitutes as a Memory Transaction */
-                                                    cacheOnbus[loop_i]->incMemtransactions();
-                                                    
-                                                    /** Flush Constitutes as a Writeback */
-                                                    cacheOnbus[loop_i]->incWB();
-                                                    
-                                                    /** Update Intervention Counter */
-                                                    cacheOnbus[loop_i]->incInterv();
-                                                    
-                                                    busControl = loop_i;
-                                                    busCommand = FLUSH;
-                                                    
-                                                    break;
-                                                    
-                                    case EXCLUSIVE: /** Update Intervention Counter */
-                                                    cacheOnbus[loop_i]->incInterv();
-                                                
-                                                    busControl = loop_i;
-                                                    busCommand = FLUSHOPT;
-                                                
-                                                    break;
-                                                    
-                                    default:    busControl = loop_i;
-                                                busCommand = FLUSHOPT;
-                                            
-                                                break;
-                                }
-                                
-                                /** Set Cache Line State To Shared */
-                                line_procn->setFlags(SHARED);
-                            }
-                        }
-                        
-                        if(busControl==procNum)
-                        {
-                            cacheOnbus[procNum]->incMemtransactions();
-                            copiesExist = NCEX;
-                        }
-                        break;
-                        
-            case BUSRDX:    for(loop_i=0; loop_i<num_processors; loop_i++)
-                            {
-                                /** Look for the Request Address in the Cache */
-                                cacheLine *line_proc = cacheOnbus[loop_i]->findLine(busAddr);
-                                
-                                /** If Found in Cache Other than Cache Serivicing the Request */
-                                if((line_proc!=NULL)&&(loop_i!=procNum))
-                                {
-                                    /** Update Invalidation Counter */
-                                    cacheOnbus[loop_i]->incInval();
-                                    
-                                    busControl = loop_i;
-                                    busCommand = FLUSHOPT;
-                                    
-                                    /** If Modified */
-                                    if(line_proc->getFlags()==MODIFIED)
-                                    {
-                                        /** Update Flush Counter */
-                                        cacheOnbus[loop_i]->incFlush();
-                                        
-                                        /** Flush Constitutes as a Memory Transaction */
-                                        cacheOnbus[loop_i]->incMemtransactions();
-                                        
-                                        /** Flush Constitutes as a Writeback */
-                                        cacheOnbus[loop_i]->incWB();
-                                        
-                                        busControl = loop_i;
-                                        busCommand = FLUSH;
-                                    }
-                                    
-                                    /** Invalidate Cache Line */
-                                    line_proc->invalidate();
-                                }
-                            }
-                            
-                            if(busControl==procNum)
-                            {
-                                cacheOnbus[procNum]->incMemtransactions();
-                            }
-                            break;
-                            
-            case BUSUPGR:   for(loop_i=0; loop_i<num_processors; loop_i++)
-                            {
-                                /** Look for the Request Address in the Cache */
-                                cacheLine *line_procn = cacheOnbus[loop_i]->findLine(busAddr);
-                                
-                                /** If Found in Cache Other than Cache Serivicing the Request */
-                                if((line_procn!=NULL)&&(loop_i!=procNum)&&(line_procn->getFlags()==SHARED))
-                                {
-                                    /** Invalidate Cache Line */
-                                    line_procn->invalidate();
-                                    
-                                    /** Update Invalidation Counter */
-                                    cacheOnbus[loop_i]->incInval();
-                                }
-                            }
-                            
-                            break;
-                                    
-            
-            default:    printf("ERROR\n");
-                        break;
-        }
+        busTransactions++;
+        cache->addTraffic(traffic.cmdBytes, cache->getLineSize());
     }
     
     /** Perform Finishing Actions */
-    if(hitMiss==HIT)
+    if(miss)
     {
-        cacheOnbus[procNum]->updateLRU(line);
-        
-        if(rdWr==WR_REQ)
+        ulong tag = cache->calcTag(reqAddr);
+        line->setTag(tag);
+        if(sharers != NULL)
         {
-            line->setFlags(MODIFIED);
+            sharers->add(tag, procNum);
         }
+        
+        /** findLineToReplace Already Recorded the Fill with the Replacement Policy */
     }
-    else
+    
+    /** Most Hits Keep their State, Skip the Store */
+    uchar next = request.next[signal & SNOOP_COPY];
+    if(next != state)
     {
-        ulong tag;
-        tag = cacheOnbus[procNum]->calcTag(reqAddr);
-        line->setTag(tag);
-        
-        cacheOnbus[procNum]->updateLRU(line);
-        
-        if(rdWr==WR_REQ)
+        line->setFlags((enum cacheFlag)next);
+    }
+    
+    if(timing != NULL)
+    {
+        enum timingSource source = SRC_NONE;
+        if(busEvents & EVENT(CNT_CACHE2CACHE))
         {
-            line->setFlags(MODIFIED);
+            source = SRC_CACHE;
         }
-        else
+        else if(busEvents & EVENT(CNT_MEM_TRANSACTIONS))
         {
-            if(copiesExist==NCEX)
-            {
-                line->setFlags(EXCLUSIVE);
-            }
-            else
-            {
-                line->setFlags(SHARED);
-            }
+            source = SRC_MEMORY;
         }
+        timing->access(procNum, request.busCommand != INVALID_BUS, source, (victimEvents & EVENT(CNT_WRITEBACKS)) != 0);
     }
-    
-    if((busCommand==FLUSHOPT)||(busCommand==FLUSH))
+}
+
+void coherenceController::processRequest(ulong procNum, uchar rdWr, ulong reqAddr)
+{
+    switch(coherenceProtocol)
     {
-        /** Update Flush Counter */
-        cacheOnbus[procNum]->incCache2cache();
+        case MSI:   processTable<msiPolicy>(procNum, rdWr, reqAddr);
+                    break;
+                    
+        case MESI:  processTable<mesiPolicy>(procNum, rdWr, reqAddr);
+                    break;
+                    
+        case DRAGON:    processTable<dragonPolicy>(procNum, rdWr, reqAddr);
+                        break;
+                        
+        case MOESI: processTable<moesiPolicy>(procNum, rdWr, reqAddr);
+                    break;
+                    
+        case MESIF: processTable<mesifPolicy>(procNum, rdWr, reqAddr);
+                    break;
     }
-    
-    /** Reset Bus */
-    busControl = 0xFF;
-    busValid = INVALID_BUS;
-    busAddr = 0xFFFFFFFF;
-    busCommand = INVALID_BUS;
-    copiesExist = NCEX;
-    
-    hitMiss = RST_OUT;
 }
 
-void coherenceController::processDRAGON(ulong procNum, uchar rdWr, ulong reqAddr)
+sharerIterator coherenceController::snoopPeers(ulong procNum, ulong addr)
 {
-    /** Increment the Cache's Request Count */
-    cacheOnbus[procNum]->inccurrentCycle();
+    Cache *cache = cacheOnbus[procNum];
     
-    /** Pointer to Cache Line to Update Finally */
-    cacheLine *line;
-    
-    /** Check Type of Read and Update Counter */
-    if(rdWr==RD_REQ)
+    if(sharers != NULL)
     {
-        cacheOnbus[procNum]->incReads();
+        sharers->getSharers(cache->calcTag(addr), snoopScratch);
     }
     else
     {
-        cacheOnbus[procNum]->incWrites();
+        memset(snoopScratch, 0, snoopWords*sizeof(ulong));
+        scanTags((const ulong *)&interleaved.lines[cache->calcIndex(addr)*interleaved.setStride], interleaved.setStride, lineKey(cache->calcTag(addr)), assoc, snoopScratch);
     }
+    snoopScratch[procNum/SHARER_WORD_BITS] &= ~(1UL << (procNum % SHARER_WORD_BITS));
     
-    /** Look for the Requested Address in the Cache */
-    line = cacheOnbus[procNum]->findLine(reqAddr);
-    
-    /** If Cache Line Not Found */
-    if(line==NULL)
-    {
-        /** Set To Miss */
-        hitMiss = MISS;
-        
-        /** Fetch a Victim Cache Line for the Data */
-        cacheLine *victim = cacheOnbus[procNum]->findLineToReplace(reqAddr);
-        assert(victim != 0);
-        
-        /** Store Victim Block to the Cache Line to Update Pointer */
-        line = victim;
-        
-        if((victim->getFlags()==MODIFIED)||(victim->getFlags()==SMODIFIED))
-        {
-            /** Update Writeback Counter */
-            cacheOnbus[procNum]->incWB();
-            
-            /** Update Memory Transaction Counter */
-            cacheOnbus[procNum]->incMemtransactions();
-        }
-        
-        /* Bus in Control of Current Processor */
-        busControl = procNum;
-        
-        /* Bus Signals are Valid */
-        busValid = VALID_BUS;
-        
-        /* Place Required Address on the Bus */
-        busAddr = reqAddr;
-        
-        if(rdWr==RD_REQ)
-        {
-            /** Update Read Miss Counters */
-            cacheOnbus[procNum]->incRM();
-            
-            /** Place BusRd Command on Bus */
-            busCommand = BUSRD;
-            
-            /** Update BusRd Counter */
-            cacheOnbus[procNum]->incBusrd();
-        }
-        else
-        {
-            /** Update Write Miss Counters */
-            cacheOnbus[procNum]->incWM();
-            
-            /** Place BusRdX Command on Bus */
-            busCommand = BUSUPD;
-            
-            /** Update BusRd Counter */
-            cacheOnbus[procNum]->incBusrd();
-            
-            /** Update BusRdX Counter */
-            cacheOnbus[procNum]->incBusupdupgr();
-        }
-    }
-    else
+    return sharerIterator(snoopScratch, snoopWords);
+}
+
+bool coherenceController::enableIntervals(const intervalParams &params)
+{
+    delete sampler;
+    sampler = new intervalSampler(params, num_processors);
+    if(!sampler->isOpen())
     {
-        /** Set To Hit */
-        hitMiss = HIT;
-        
-        /** If Hit Cache Line in Shared State and a Write is Required */
-        if(((line->getFlags()==SMODIFIED)||(line->getFlags()==SCLEAN))&&(rdWr==WR_REQ))
-        {
-            /* Bus in Control of Current Processor */
-            busControl = procNum;
-            
-            /* Bus Signals are Valid */
-            busValid = VALID_BUS;
-            
-            /* Place Required Address on the Bus */
-            busAddr = reqAddr;
-            
-            /** Place BusRdX Command on Bus */
-            busCommand = BUSUPD;
-            
-            /** Update BusRdX Counter */
-            cacheOnbus[procNum]->incBusupdupgr();
-        }
+        delete sampler;
+        sampler = NULL;
+        return false;
     }
     
-    /* Perform Bus Snooping Operations */
-    if(busValid==VALID_BUS)
+    return true;
+}
+
+void coherenceController::processBatch(const traceRecord *batch, ulong numRecords)
+{
+    ulong loop_r;
+    for(loop_r=0; loop_r<numRecords; loop_r++)
     {
-        uchar loop_i;
-        
-        switch(busCommand)
-        {
-            case BUSRD: if(hitMiss==MISS)
-			{
-				cacheOnbus[procNum]->incMemtransactions();
-			}
-			for(loop_i=0; loop_i<num_processors; loop_i++)
-                        {
-                            /** Look for the Request Address in the Cache */
-                            cacheLine *line_procn = cacheOnbus[loop_i]->findLine(busAddr);
-                            
-                            /** If Found in Cache Other than Cache Serivicing the Request */
-                            if((line_procn!=NULL)&&(loop_i!=procNum))
-                            {
-                                /** Copies Exist */
-                                copiesExist = CEX;
-                                
-                                switch(line_procn->getFlags())
-                                {
-                                    case MODIFIED:  /** Update Flush Counter */
-                                                    cacheOnbus[loop_i]->incFlush();
-                                                    
-                                                    /** Update Intervention Counter */
-                                                    cacheOnbus[loop_i]->incInterv();
-                                                    
-                                                    //cacheOnbus[loop_i]->incMemtransactions();
-                                                    
-                                                    /** Set Cache Line State To Shared */
-                                                    line_procn->setFlags(SMODIFIED);
-                                                    
-                                                    busControl = loop_i;
-                                                    busCommand = FLUSH;
-                                                    
-                                                    break;
-                                                    
-                                    case EXCLUSIVE: /** Update Intervention Counter - Unsure */
-                                                    cacheOnbus[loop_i]->incInterv();
-                                                    
-                                                    /** Set Cache Line State To Shared */
-                                                    line_procn->setFlags(SCLEAN);
-                                                    
-                                                    busControl = loop_i;
-                                                    
-                                                    break;
-                                                    
-                                    case SMODIFIED: /** Update Flush Counter */
-                                                    cacheOnbus[loop_i]->incFlush();
-                                                    
-                                                    /** Set Cache Line State To Shared */
-                                                    line_procn->setFlags(SMODIFIED);
-                                                    
-                                                    //cacheOnbus[loop_i]->incMemtransactions();
-                                                    
-                                                    busControl = loop_i;
-                                                    busCommand = FLUSH;
-                                                    break;
-                                                    
-                                    case SCLEAN:    busControl = loop_i;
-                                                    break;
-                                                    
-                                    default:    printf("ERROR\n");
-                                }
-                            }
-                        }
-                        
-                        if(busControl==procNum)
-                        {
-                            //cacheOnbus[procNum]->incMemtransactions();
-                            //copiesExist = NCEX; //Redundant
-                        }
-                        else
-                        if(busCommand!=FLUSH)
-                        {
-                            //cacheOnbus[procNum]->incMemtransactions();
-                        }
-                        break;
-                        
-            case BUSUPD:    if(hitMiss==MISS)
-			    {
-				cacheOnbus[procNum]->incMemtransactions();
-			    }
-			    for(loop_i=0; loop_i<num_processors; loop_i++)
-                            {
-                                /** Look for the Request Address in the Cache */
-                                cacheLine *line_proc = cacheOnbus[loop_i]->findLine(busAddr);
-                                
-                                /** If Found in Cache Other than Cache Serivicing the Request */
-                                if((line_proc!=NULL)&&(loop_i!=procNum))
-                                {
-                                    /** Copies Exist */
-                                    copiesExist = CEX;
-                                    
-                                    switch(line_proc->getFlags())
-                                    {
-                                        case MODIFIED:  /** Update Flush Counter */
-                                                        cacheOnbus[loop_i]->incFlush();
-                                                        
-                                                        /** Update Intervention Counter */
-                                                        cacheOnbus[loop_i]->incInterv();
-                                                        
-                                                        //cacheOnbus[loop_i]->incMemtransactions();
-                                                        
-                                                        /** Set Cache Line State To Shared */
-                                                        line_proc->setFlags(SCLEAN);
-                                                        
-                                                        busControl = loop_i;
-                                                        busCommand = FLUSH;
-                                                        
-                                                        break;
-                                                        
-                                        case EXCLUSIVE: /** Update Intervention Counter - Unsure */
-                                                        cacheOnbus[loop_i]->incInterv();
-                                                        
-                                                        busControl = loop_i;
-                                                        
-                                                        /** Set Cache Line State To Shared */
-                                                        line_proc->setFlags(SCLEAN);
-                                                        
-                                                        break;
-                                                        
-                                        case SMODIFIED: if(hitMiss==MISS)
-                                                        {
-                                                            /** Update Flush Counter */
-                                                            cacheOnbus[loop_i]->incFlush();
-                                                            //cacheOnbus[loop_i]->incMemtransactions();
-                                                        }
-                                                        
-                                                        busControl = loop_i;
-                                                        busCommand = FLUSH;
-                                                        
-                                                        /** Set Cache Line State To Shared */
-                                                        line_proc->setFlags(SCLEAN);
-                                                        
-                                                        break;
-                                                    
-                                        case SCLEAN:    busControl = loop_i;
-                                                        break;
-                                                        
-                                        default:    printf("ERROR\n");
-                                    }
-                                }
-                            }
-                            
-                            if(busControl==procNum)
-                            {
-                                if(hitMiss==MISS)
-                                {
-                                    //cacheOnbus[procNum]->incMemtransactions();
-                                }
-                                //copiesExist = NCEX;   //Redundant
-                            }
-                            else
-                            if((busCommand!=FLUSH)&&(hitMiss==MISS))
-                            {
-                                //cacheOnbus[procNum]->incMemtransactions();
-                            }
-                            break;
-                            
-            default:    printf("ERROR\n");
-        }
+        processRequest(batch[loop_r].procNum, batch[loop_r].rdWr, batch[loop_r].addr);
     }
+}
+
+template<class Policy>
+void protocolController<Policy>::processBatch(const traceRecord *batch, ulong numRecords)
+{
+    ulong loop_r;
     
-    /** Perform Finishing Actions */
-    if(hitMiss==HIT)
+    if(sampler != NULL)
     {
-        cacheOnbus[procNum]->updateLRU(line);
-        
-        if(rdWr==WR_REQ)
+        for(loop_r=0; loop_r<numRecords; loop_r++)
         {
-            switch(line->getFlags())
+            processTable<Policy>(batch[loop_r].procNum, batch[loop_r].rdWr, batch[loop_r].addr);
+            if(sampler->due(busTransactions))
             {
-                case EXCLUSIVE: line->setFlags(MODIFIED);
-                                break;
-                                
-                default:    if(copiesExist==NCEX)
-                            {
-                                line->setFlags(MODIFIED);
-                            }
-                            else
-                            {
-                                line->setFlags(SMODIFIED);
-                            }
+                sampler->sample(cacheOnbus, busTransactions);
             }
         }
+        return;
     }
-    else
+    
+    for(loop_r=0; loop_r<numRecords; loop_r++)
     {
-        ulong tag;
-        tag = cacheOnbus[procNum]->calcTag(reqAddr);
-        line->setTag(tag);
-        
-        cacheOnbus[procNum]->updateLRU(line);
-        
-        if(rdWr==WR_REQ)
-        {
-            if(copiesExist==NCEX)
-            {
-                line->setFlags(MODIFIED);
-            }
-            else
-            {
-                line->setFlags(SMODIFIED);
-            }
-        }
-        else
-        {
-            if(copiesExist==NCEX)
-            {
-                line->setFlags(EXCLUSIVE);
-            }
-            else
-            {
-                line->setFlags(SCLEAN);
-            }
-        }
+        processTable<Policy>(batch[loop_r].procNum, batch[loop_r].rdWr, batch[loop_r].addr);
+    }
+}
+
+template class protocolController<msiPolicy>;
+template class protocolController<mesiPolicy>;
+template class protocolController<dragonPolicy>;
+template class protocolController<moesiPolicy>;
+template class protocolController<mesifPolicy>;
+
+coherenceController *createController(int s, int a, int b, int numP, enum coh_protocol cohProtocol, enum replKind repl, enum tagLayout layout)
+{
+    switch(cohProtocol)
+    {
+        case MSI:       return new protocolController<msiPolicy>(s, a, b, numP, repl, layout);
+        case MESI:      return new protocolController<mesiPolicy>(s, a, b, numP, repl, layout);
+        case DRAGON:    return new protocolController<dragonPolicy>(s, a, b, numP, repl, layout);
+        case MOESI:     return new protocolController<moesiPolicy>(s, a, b, numP, repl, layout);
+        case MESIF:     return new protocolController<mesifPolicy>(s, a, b, numP, repl, layout);
     }
     
-    /** Reset Bus */
-    busControl = 0xFF;
-    busValid = INVALID_BUS;
-    busAddr = 0xFFFFFFFF;
-    busCommand = INVALID_BUS;
-    copiesExist = NCEX;
-    
-    hitMiss = RST_OUT;
+    return NULL;
+}
+
+void coherenceController::mergeMetrics(coherenceController *other)
+{
+    int loop_i;
+    for(loop_i=0; loop_i<num_processors; loop_i++)
+    {
+        cacheOnbus[loop_i]->addCounters(other->cacheOnbus[loop_i]);
+    }
+    busTransactions += other->busTransactions;
 }
 
 void coherenceController::dumpMetrics()
 {
-    uchar loop_i;
+    int loop_i;
     for(loop_i=0; loop_i<num_processors; loop_i++)
     {
         
-        printf("============ Simulation results (Cache %u) ============\n",(uint)loop_i);
+        printf("============ Simulation results (Cache %d) ============\n",loop_i);
         printf("01. number of reads:    \t\t\t%lu\n", cacheOnbus[loop_i]->getReads());
         printf("02. number of read misses:      \t\t%lu\n", cacheOnbus[loop_i]->getRM());
         printf("03. number of writes:   \t\t\t%lu\n", cacheOnbus[loop_i]->getWrites());
@@ -897,4 +434,46 @@ void coherenceController::dumpMetrics()
         printf("11. number of flushes:  \t\t\t%lu\n", cacheOnbus[loop_i]->getFlush());
         printf("12. number of BusRdX:   \t\t\t%lu\n", cacheOnbus[loop_i]->getBusrdx());
     }
+    
+    if(traffic.report)
+    {
+        dumpTraffic();
+    }
+    
+    if(timing != NULL)
+    {
+        timing->dumpStats();
+    }
+    
+    if(profiler != NULL)
+    {
+        profiler->dumpStats();
+    }
+    
+    if(directory != NULL)
+    {
+        directory->dumpStats(busTransactions);
+    }
+}
+
+void coherenceController::dumpTraffic()
+{
+    ulong ctrlBytes = 0, dataBytes = 0, refs = 0;
+    int loop_i;
+    
+    printf("============ Bus traffic (bytes) ============\n");
+    printf("sizes: command %u, update word %u, block %lu\n", traffic.cmdBytes, traffic.wordBytes, cacheOnbus[0]->getLineSize());
+    for(loop_i=0; loop_i<num_processors; loop_i++)
+    {
+        Cache *cache = cacheOnbus[loop_i];
+        printf("Cache %d: control %lu\tdata %lu\ttotal %lu\n", loop_i, cache->getCtrlBytes(), cache->getDataBytes(), cache->getCtrlBytes() + cache->getDataBytes());
+        ctrlBytes += cache->getCtrlBytes();
+        dataBytes += cache->getDataBytes();
+        refs += cache->getReads() + cache->getWrites();
+    }
+    
+    ulong total = ctrlBytes + dataBytes;
+    printf("total bytes on bus:             \t%lu\n", total);
+    printf("data / control:                 \t%.2f%% / %.2f%%\n", total ? (double)dataBytes*100.0/total : 0.0, total ? (double)ctrlBytes*100.0/total : 0.0);
+    printf("bytes per reference:            \t%.2f\n", refs ? (double)total/refs : 0.0);
 }
@@ -9,6 +9,14 @@
 #define __COHERENCE_CTRL_H__
 
 #include "cache.h"
+#include "trace_reader.h"
+#include "sharer_dir.h"
+#include "protocol_table.h"
+#include "timing_model.h"
+#include "bus_traffic.h"
+#include "interval_stats.h"
+#include "sharing_profiler.h"
+#include "directory.h"
 
 /** Type define unsigned long as ulong */
 typedef unsigned long ulong;
@@ -19,27 +27,46 @@ typedef unsigned char uchar;
 /** Type define unsigned int as uint */
 typedef unsigned int uint;
 
-/** Coherence Bus State Enumeration */
-enum bus_state  {
-                    INVALID_BUS =   0,  /**< Bus Inactive - Used In All Protocols */
-                    VALID_BUS =     1,  /**< Bus Active - Used In All Protocols */
-                    BUSRD =         2,  /**< Bus Read Command - Used In All Protocols */
-                    BUSRDX =        3,  /**< Bus Read Exclusive (Write) Command - Used In MSI & MESI Protocols */
-                    FLUSH =         4,  /**< Flush Command - Used In All Protocols */
-                    BUSUPGR =       5,  /**< Bus Upgrade Command - Used In MESI Protocol */
-                    FLUSHOPT =      6,  /**< Flush Optimized - Used In MESI Protocol */
-                    BUSUPD =        7,  /**< Bus Update Command - Used In Dragon Protocol */
-                    CEX =           8,  /**< Copies Exist Signal - Used In MESI & Dragon Protocols */
-                    NCEX =          9   /**< Copies Do Not Exist Signal - Used In MESI & Dragon Protocols */
-};
-
 /** Coherence Protocol Type Enumeration */
 enum coh_protocol   {
                         MSI = 0,    /**< MSI Coherence Protocol */
                         MESI = 1,   /**< MESI Coherence Protocol */
-                        DRAGON = 2  /**< Dragon Coherence Protocol */
+                        DRAGON = 2, /**< Dragon Coherence Protocol */
+                        MOESI = 3,  /**< MOESI Coherence Protocol */
+                        MESIF = 4   /**< MESIF Coherence Protocol */
 };
 
+/** Number of Coherence Protocols */
+#define NUM_COH_PROTOCOLS 5
+
+/**
+ * \brief Get the Printable Name of a Coherence Protocol
+ * \param[in] cohProtocol Coherence Protocol
+ * \return Protocol Name as Printed in the Simulator Configuration
+ */
+const char *getProtocolName(enum coh_protocol cohProtocol);
+
+/** Tag and State Storage Layout Enumeration */
+enum tagLayout  {
+                    LAYOUT_PRIVATE =        0,  /**< Each Cache Owns its Arrays, Snoops Look Up the Sharer Directory */
+                    LAYOUT_INTERLEAVED =    1   /**< Controller Owns Set Major Arrays, Snoops Scan One Set of Every Cache */
+};
+
+/**
+ * \brief Parse a Tag Layout Name
+ * \param[in] name "private" or "interleaved"
+ * \param[out] layout Parsed Layout
+ * \return Whether the Name is Known
+ */
+bool parseTagLayout(const char *name, enum tagLayout &layout);
+
+/**
+ * \brief Get the Printable Name of a Tag Layout
+ * \param[in] layout Layout
+ * \return Layout Name as Given to --layout
+ */
+const char *getTagLayoutName(enum tagLayout layout);
+
 /** Cache Tag Search Outcome Enumeration */
 enum searchOutcome  {
                         MISS =  0,      /**< Cache Miss */
@@ -50,23 +77,45 @@ enum searchOutcome  {
 /** 
  * \class coherenceController
  * \brief Class for a Cache Coherence Controller
+ *
+ * Built with createController, which returns the protocolController
+ * specialized for the requested protocol.
  */
 class coherenceController
 {
 protected:
     int num_processors;                     /**< Number of Processors Managed/Simulated by the Coherence Controller */
     enum coh_protocol coherenceProtocol;    /**< Coherence Protocol In Use */
-    uchar busControl;                       /**< Processor having Bus Control */
-    enum bus_state busValid;                /**< Current Bus State */
-    ulong busAddr;                          /**< Address on the Bus */
-    ulong busData;                          /**< Data on the Bus - Not Used in the Simulator */
-    enum bus_state copiesExist;             /**< Copies Exist Bus Signal */
-    enum bus_state busCommand;              /**< Command on the Bus */
-    enum searchOutcome hitMiss;             /**< Search Hit or Miss */
     
     Cache **cacheOnbus;                     /**< Pointer to a Pointer to Cache class object */
+    sharerDirectory *sharers;               /**< Caches Holding Each Block, Kept Exact on Fill, Evict and Invalidate, NULL When Interleaved */
+    ulong *snoopScratch;                    /**< Copy of the Sharer Set Walked by the Current Snoop */
+    ulong snoopWords;                       /**< Words of a Sharer Set */
+    enum tagLayout layout;                  /**< Tag and State Storage Layout */
+    cacheStore interleaved;                 /**< Set Major Slab of Every Cache, When Interleaved */
+    void *layoutStorage;                    /**< Zero Pages Backing interleaved, NULL When Private */
+    ulong layoutBytes;                      /**< Size of layoutStorage */
+    tagScanFn scanTags;                     /**< Kernel Scanning One Set of Every Cache */
+    ulong assoc;                            /**< Ways per Set of Every Cache */
+    timingModel *timing;                    /**< Timing Model, NULL When Only Counting Events */
+    trafficParams traffic;                  /**< Bytes Charged to Bus Transactions */
+    intervalSampler *sampler;               /**< Interval Statistics, NULL When Not Sampling */
+    ulong busTransactions;                  /**< Bus Commands Issued, Writebacks Included */
+    sharingProfiler *profiler;              /**< Per Block Sharing Profile, NULL When Not Profiling */
+    coherenceDirectory *directory;          /**< Directory Message Model, NULL for a Snooping Bus Only */
     
-public:
+    /**
+     * \brief Get the Caches to Snoop for a Bus Transaction
+     *
+     * The private layout looks the block up in the sharer directory. The
+     * interleaved layout compares the tags of the block's set in every
+     * cache, which are contiguous, in one vector scan.
+     *
+     * \param[in] procNum Processor Placing the Transaction on the Bus
+     * \param[in] addr Address on the Bus
+     * \return Iterator over Every Other Processor Whose Cache Holds the Block
+     */
+    sharerIterator snoopPeers(ulong procNum, ulong addr);
     
     /**
      * \brief coherenceController class Constructor
@@ -75,19 +124,165 @@ public:
      * \param[in] b Cache Block Size
      * \param[in] numP Number of Processors
      * \param[in] cohProtocol Coherence Protocol to Use
+     * \param[in] repl Replacement Policy of Every Cache
+     * \param[in] lay Tag and State Storage Layout
      */
-    coherenceController(int s, int a, int b, int numP, enum coh_protocol cohProtocol);
+    coherenceController(int s, int a, int b, int numP, enum coh_protocol cohProtocol, enum replKind repl, enum tagLayout lay);
+    
+public:
     
     /**
      * \brief coherenceController class Destructor
      */
-    ~coherenceController() 
+    virtual ~coherenceController() 
+    {
+        int loop_i;
+        for(loop_i=0; loop_i<num_processors; loop_i++)
+        {
+            delete cacheOnbus[loop_i];
+        }
+        delete [] cacheOnbus; 
+        freeZeroPages(layoutStorage, layoutBytes);
+        delete sharers;
+        delete [] snoopScratch;
+        delete timing;
+        delete sampler;
+        delete profiler;
+        delete directory;
+    }
+    
+    /**
+     * \brief Get Number of Processors
+     * \return Number of Processors Simulated by the Coherence Controller
+     */
+    int getNumProcessors()
+    {
+        return num_processors;
+    }
+    
+    /**
+     * \brief Get Coherence Protocol
+     * \return Coherence Protocol In Use
+     */
+    enum coh_protocol getProtocol()
+    {
+        return coherenceProtocol;
+    }
+    
+    /**
+     * \brief Get Replacement Policy
+     * \return Replacement Policy of Every Cache
+     */
+    enum replKind getReplacement()
+    {
+        return cacheOnbus[0]->getReplacement();
+    }
+    
+    /**
+     * \brief Get Tag Layout
+     * \return Tag and State Storage Layout
+     */
+    enum tagLayout getLayout()
+    {
+        return layout;
+    }
+    
+    /**
+     * \brief Get the Cache of a Processor
+     * \param[in] procNum Processor Number
+     * \return Pointer to the Processor's Cache
+     */
+    Cache *getCache(int procNum)
+    {
+        return cacheOnbus[procNum];
+    }
+    
+    /**
+     * \brief Set the Bytes Charged to Bus Transactions
+     * \param[in] params Transaction Sizes, and Whether dumpMetrics Prints the Traffic
+     */
+    void setTraffic(const trafficParams &params)
+    {
+        traffic = params;
+    }
+    
+    /**
+     * \brief Get the Bytes Charged to Bus Transactions
+     * \return Transaction Sizes
+     */
+    const trafficParams &getTraffic()
+    {
+        return traffic;
+    }
+    
+    /**
+     * \brief Time Every Following Access with the Timing Model
+     * \param[in] params Latencies in Cycles
+     */
+    void enableTiming(const timingParams &params)
+    {
+        delete timing;
+        timing = createTimingModel(params, num_processors);
+    }
+    
+    /**
+     * \brief Profile the Coherence Events of Every Following Bus Transaction by Block
+     * \param[in] params Profile Sizes
+     */
+    void enableProfiler(const profileParams &params)
+    {
+        delete profiler;
+        profiler = new sharingProfiler(params, num_processors);
+    }
+    
+    /**
+     * \brief Count the Messages a Directory Would Send for Every Following Transaction
+     * \param[in] params Directory Organization
+     */
+    void enableDirectory(const directoryParams &params)
+    {
+        delete directory;
+        directory = new coherenceDirectory(params, num_processors, cacheOnbus[0]->getLineSize());
+    }
+    
+    /**
+     * \brief Get the Directory Counting Messages
+     * \return Directory, NULL Unless Enabled
+     */
+    coherenceDirectory *getDirectory()
+    {
+        return directory;
+    }
+    
+    /**
+     * \brief Write the Counter Deltas of Every Following Interval to a File
+     * \param[in] params Interval Length and File Name
+     * \return Whether the File Could be Created
+     */
+    bool enableIntervals(const intervalParams &params);
+    
+    /**
+     * \brief Write the Last, Partial Interval, Call After the Trace Ends
+     */
+    void finishIntervals()
     {
-        delete cacheOnbus; 
+        if(sampler != NULL)
+        {
+            sampler->finish(cacheOnbus, busTransactions);
+        }
     }
     
     /**
-     * \brief Process a CPU Access Request
+     * \brief Get the Number of Bus Transactions
+     * \return Bus Commands Issued, Writebacks Included
+     */
+    ulong getBusTransactions()
+    {
+        return busTransactions;
+    }
+    
+    /**
+     * \brief Process a CPU Access Request, Dispatching on the Protocol at Run Time
      * \param[in] procNum Processor Requesting the Address
      * \param[in] rdWr Type of Request (R/W)
      * \param[in] reqAddr Address the Processor is Requesting
@@ -95,33 +290,141 @@ public:
     void processRequest(ulong procNum, uchar rdWr, ulong reqAddr);
     
     /**
-     * \brief Process a CPU Access Request using MSI Protocol
-     * \param[in] procNum Processor Requesting the Address
-     * \param[in] rdWr Type of Request (R/W)
-     * \param[in] reqAddr Address the Processor is Requesting
+     * \brief Process a Batch of Decoded Trace Records in Order
+     *
+     * The base version calls processRequest per record. protocolController
+     * overrides it with a loop bound to one protocol at compile time.
+     *
+     * \param[in] batch Decoded Trace Records
+     * \param[in] numRecords Number of Records in the Batch
      */
-    void processMSI(ulong procNum, uchar rdWr, ulong reqAddr);
+    virtual void processBatch(const traceRecord *batch, ulong numRecords);
     
     /**
-     * \brief Process a CPU Access Request using MESI Protocol
+     * \brief Process a CPU Access Request by Walking the Policy's Protocol Table
      * \param[in] procNum Processor Requesting the Address
      * \param[in] rdWr Type of Request (R/W)
      * \param[in] reqAddr Address the Processor is Requesting
      */
-    void processMESI(ulong procNum, uchar rdWr, ulong reqAddr);
+    template<class Policy>
+    void processTable(ulong procNum, uchar rdWr, ulong reqAddr);
     
     /**
-     * \brief Process a CPU Access Request using Dragon Protocol
-     * \param[in] procNum Processor Requesting the Address
-     * \param[in] rdWr Type of Request (R/W)
-     * \param[in] reqAddr Address the Processor is Requesting
+     * \brief Add Another Controller's Counters, Cache by Cache
+     * \param[in] other Controller with the Same Processor Count
      */
-    void processDRAGON(ulong procNum, uchar rdWr, ulong reqAddr);
+    void mergeMetrics(coherenceController *other);
     
     /**
-     * \brief Print Coherence Controller Statistics
+     * \brief Print Bus Traffic in Bytes per Cache and in Total
+     */
+    void dumpTraffic();
+    
+    /**
+     * \brief Print Coherence Controller Statistics, and the Traffic, Timing, Sharing Profile and Directory Messages if Enabled
      */
     void dumpMetrics();
 };
 
+/**
+ * \struct msiPolicy
+ * \brief Protocol Policy Selecting the MSI Protocol Table
+ */
+struct msiPolicy
+{
+    static const enum coh_protocol protocol = MSI;      /**< Protocol Implemented */
+    static constexpr protocolTable table = makeMSITable();   /**< Transitions of the Protocol */
+};
+
+/**
+ * \struct mesiPolicy
+ * \brief Protocol Policy Selecting the MESI Protocol Table
+ */
+struct mesiPolicy
+{
+    static const enum coh_protocol protocol = MESI;     /**< Protocol Implemented */
+    static constexpr protocolTable table = makeMESITable();   /**< Transitions of the Protocol */
+};
+
+/**
+ * \struct dragonPolicy
+ * \brief Protocol Policy Selecting the Dragon Protocol Table
+ */
+struct dragonPolicy
+{
+    static const enum coh_protocol protocol = DRAGON;   /**< Protocol Implemented */
+    static constexpr protocolTable table = makeDragonTable();   /**< Transitions of the Protocol */
+};
+
+/**
+ * \struct moesiPolicy
+ * \brief Protocol Policy Selecting the MOESI Protocol Table
+ */
+struct moesiPolicy
+{
+    static const enum coh_protocol protocol = MOESI;    /**< Protocol Implemented */
+    static constexpr protocolTable table = makeMOESITable();   /**< Transitions of the Protocol */
+};
+
+/**
+ * \struct mesifPolicy
+ * \brief Protocol Policy Selecting the MESIF Protocol Table
+ */
+struct mesifPolicy
+{
+    static const enum coh_protocol protocol = MESIF;    /**< Protocol Implemented */
+    static constexpr protocolTable table = makeMESIFTable();   /**< Transitions of the Protocol */
+};
+
+/**
+ * \class protocolController
+ * \brief Coherence Controller Specialized at Compile Time for One Protocol
+ *
+ * The protocol is chosen once, when the controller is created, so the per
+ * reference loop carries no protocol dispatch and the request handler can
+ * be inlined into it. Instantiated in coherence_ctrl.cc for each policy.
+ */
+template<class Policy>
+class protocolController : public coherenceController
+{
+public:
+    
+    /**
+     * \brief protocolController class Constructor
+     * \param[in] s Cache Size
+     * \param[in] a Cache Associativity
+     * \param[in] b Cache Block Size
+     * \param[in] numP Number of Processors
+     * \param[in] repl Replacement Policy of Every Cache
+     * \param[in] lay Tag and State Storage Layout
+     */
+    protocolController(int s, int a, int b, int numP, enum replKind repl, enum tagLayout lay) : coherenceController(s, a, b, numP, Policy::protocol, repl, lay)
+    {
+    }
+    
+    /**
+     * \brief Process a Batch of Decoded Trace Records in Order
+     *
+     * Without interval sampling the loop is the bare request handler;
+     * with it each record also checks for the end of the interval.
+     *
+     * \param[in] batch Decoded Trace Records
+     * \param[in] numRecords Number of Records in the Batch
+     */
+    void processBatch(const traceRecord *batch, ulong numRecords);
+};
+
+/**
+ * \brief Create the Coherence Controller Specialized for a Protocol
+ * \param[in] s Cache Size
+ * \param[in] a Cache Associativity
+ * \param[in] b Cache Block Size
+ * \param[in] numP Number of Processors
+ * \param[in] cohProtocol Coherence Protocol to Use
+ * \param[in] repl Replacement Policy of Every Cache
+ * \param[in] layout Tag and State Storage Layout
+ * \return New Controller, Owned by the Caller
+ */
+coherenceController *createController(int s, int a, int b, int numP, enum coh_protocol cohProtocol, enum replKind repl = REPL_LRU, enum tagLayout layout = LAYOUT_PRIVATE);
+
 #endif
@@ -0,0 +1,158 @@
+/**
+ * \file ctrl_bench.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Coherence Controller Throughput Benchmark (Run Time vs Compile Time Protocol Dispatch)
+ *
+ * Decodes the trace once, then for each protocol times the base
+ * coherenceController::processBatch, which dispatches on the protocol for
+ * every reference, against the protocolController specialization.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <vector>
+
+#include "coherence_ctrl.h"
+#include "trace_reader.h"
+
+using namespace std;
+
+/**
+ * \brief Wall Clock Time
+ * \return Seconds Since the Epoch
+ */
+static double wallTime()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec*1e-6;
+}
+
+/**
+ * \brief Checksum of Every Counter of Every Cache
+ * \param[in] ctrl Controller to Summarize
+ * \return Checksum
+ */
+static ulong counterChecksum(coherenceController *ctrl)
+{
+    ulong sum = 0;
+    int loop_i;
+
+    for(loop_i=0; loop_i<ctrl->getNumProcessors(); loop_i++)
+    {
+        Cache *cache = ctrl->getCache(loop_i);
+        sum = sum*31 + cache->getReads() + cache->getRM()*3 + cache->getWrites()*5 + cache->getWM()*7 + cache->getWB()*11;
+        sum = sum*31 + cache->getCache2cache() + cache->getMemtransactions()*3 + cache->getInterv()*5 + cache->getInval()*7;
+        sum = sum*31 + cache->getFlush() + cache->getBusrd()*3 + cache->getBusrdx()*5 + cache->getBusupdupgr()*7;
+    }
+
+    return sum;
+}
+
+/**
+ * \brief Simulate the Trace with a Fresh Controller
+ * \param[in] records Decoded Trace
+ * \param[in] argv Cache Size, Associativity, Block Size and Processor Count
+ * \param[in] protocol Coherence Protocol
+ * \param[in] specialized Use the protocolController Loop Rather than Run Time Dispatch
+ * \param[out] checksum Counter Checksum of the Run
+ * \return Seconds Taken
+ */
+static double benchRun(const vector<traceRecord> &records, const int *argv, enum coh_protocol protocol, bool specialized, ulong *checksum)
+{
+    coherenceController *ctrl = createController(argv[0], argv[1], argv[2], argv[3], protocol);
+    double start = wallTime();
+
+    if(specialized)
+    {
+        ctrl->processBatch(&records[0], records.size());
+    }
+    else
+    {
+        ctrl->coherenceController::processBatch(&records[0], records.size());
+    }
+
+    double seconds = wallTime() - start;
+    *checksum = counterChecksum(ctrl);
+    delete ctrl;
+
+    return seconds;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+    {
+        printf("input format: ");
+        printf("./ctrl_bench <trace_file> [iterations] [cache_size] [assoc] [block_size] [num_processors] \n");
+        exit(0);
+    }
+
+    int iterations = (argc > 2) ? atoi(argv[2]) : 5;
+    int config[4] = {8192, 8, 64, 4};
+    int loop_a;
+    for(loop_a=0; (loop_a<4) && (loop_a+3<argc); loop_a++)
+    {
+        config[loop_a] = atoi(argv[loop_a + 3]);
+    }
+    if(iterations < 1)
+    {
+        iterations = 1;
+    }
+
+    traceReader trace;
+    vector<traceRecord> records;
+    if(!trace.open(argv[1]) || !trace.readAll(records) || records.empty())
+    {
+        printf("Trace file problem\n");
+        exit(0);
+    }
+    ulong loop_r;
+    for(loop_r=0; loop_r<records.size(); loop_r++)
+    {
+        if(records[loop_r].procNum >= (uint)config[3])
+        {
+            printf("Trace file problem: processor %u out of range\n", records[loop_r].procNum);
+            exit(0);
+        }
+    }
+
+    printf("===== Coherence controller benchmark =====\n");
+    printf("TRACE FILE: %s (%lu references)\n", argv[1], (ulong)records.size());
+    printf("CONFIG: %d %d %d %d, best of %d\n", config[0], config[1], config[2], config[3], iterations);
+
+    const enum coh_protocol protocols[] = {MSI, MESI, DRAGON, MOESI, MESIF};
+    int rc = 0;
+    ulong loop_p;
+
+    for(loop_p=0; loop_p<sizeof(protocols)/sizeof(protocols[0]); loop_p++)
+    {
+        double bestDispatch = 0.0, bestSpecialized = 0.0;
+        ulong sumDispatch = 0, sumSpecialized = 0;
+        int loop_i;
+
+        /** Best of Several Runs, Alternating so Both Paths See the Same Machine State */
+        for(loop_i=0; loop_i<iterations; loop_i++)
+        {
+            double t = benchRun(records, config, protocols[loop_p], false, &sumDispatch);
+            bestDispatch = ((loop_i == 0) || (t < bestDispatch)) ? t : bestDispatch;
+
+            t = benchRun(records, config, protocols[loop_p], true, &sumSpecialized);
+            bestSpecialized = ((loop_i == 0) || (t < bestSpecialized)) ? t : bestSpecialized;
+        }
+
+        double refs = (double)records.size();
+        printf("%-7s\trun time dispatch %.0f refs/sec\tspecialized %.0f refs/sec\tspeedup %.2fx\n",
+               getProtocolName(protocols[loop_p]), refs/bestDispatch, refs/bestSpecialized, bestDispatch/bestSpecialized);
+
+        if(sumDispatch != sumSpecialized)
+        {
+            printf("MISMATCH: %s counters differ between the two paths\n", getProtocolName(protocols[loop_p]));
+            rc = 1;
+        }
+    }
+
+    return rc;
+}
@@ -0,0 +1,468 @@
+/**
+ * \file directory.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Directory Based Coherence Message and Storage Model
+ */
+
+#include "directory.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace std;
+
+/** Bit of an Entry's First Word Set Once its Pointers Overflowed */
+#define DIR_OVERFLOW (1UL << 32)
+
+/** Bit of an Entry's First Word Set While a Cache Owns the Block, Holding the Only Up to Date Copy */
+#define DIR_OWNED (1UL << 33)
+
+/** Position of the Owning Processor in an Entry's First Word */
+#define DIR_OWNER_SHIFT 40
+
+/** Sharer Count Held in the Low Half of an Entry's First Word */
+#define DIR_COUNT(word) ((word) & 0xFFFFFFFFUL)
+
+/** Owning Processor of an Entry's First Word, Valid While DIR_OWNED is Set */
+#define DIR_OWNER(word) ((word) >> DIR_OWNER_SHIFT)
+
+/**
+ * \brief Make a Processor the Owner in an Entry's First Word
+ * \param[in] word First Word of the Entry
+ * \param[in] procNum Owning Processor
+ * \return First Word with the Owner Set
+ */
+static inline ulong setOwner(ulong word, ulong procNum)
+{
+    return (word & ((1UL << DIR_OWNER_SHIFT) - 1)) | DIR_OWNED | (procNum << DIR_OWNER_SHIFT);
+}
+
+bool parseDirectoryParams(const char *text, directoryParams &params)
+{
+    if(strcmp(text, "full") == 0)
+    {
+        params.org = DIR_FULL;
+        params.pointers = 0;
+        return true;
+    }
+
+    if(strncmp(text, "dir", 3) != 0)
+    {
+        return false;
+    }
+
+    char *end;
+    unsigned long value = strtoul(text + 3, &end, 10);
+    if((end == text + 3) || (value < 1) || (value > DIR_MAX_POINTERS))
+    {
+        return false;
+    }
+
+    if(strcmp(end, "b") == 0)
+    {
+        params.org = DIR_PTR_B;
+    }
+    else if(strcmp(end, "nb") == 0)
+    {
+        params.org = DIR_PTR_NB;
+    }
+    else if(strcmp(end, "cv") == 0)
+    {
+        params.org = DIR_COARSE;
+    }
+    else
+    {
+        return false;
+    }
+    params.pointers = (uint)value;
+
+    return true;
+}
+
+coherenceDirectory::coherenceDirectory(const directoryParams &p, int numP, ulong blockSize)
+{
+    params = p;
+    numProcs = (ulong)numP;
+    blockBytes = blockSize;
+
+    pointerBits = 1;
+    while((1UL << pointerBits) < numProcs)
+    {
+        pointerBits++;
+    }
+
+    /** Dir_i_CV Reuses the Pointer Bits as a Vector, Each Bit Covering groupSize Processors */
+    coarseBits = params.pointers*pointerBits;
+    groupSize = (coarseBits > 0) ? (numProcs + coarseBits - 1)/coarseBits : 1;
+
+    if(params.org == DIR_FULL)
+    {
+        entryWords = 1 + (numProcs + 63)/64;
+    }
+    else
+    {
+        entryWords = 1 + params.pointers;
+    }
+    peakEntries = 0;
+
+    memset(messages, 0, sizeof(messages));
+    requests = 0;
+    hops = 0;
+    maxMessages = 0;
+    overflowed = 0;
+    extraMessages = 0;
+    recalls = 0;
+}
+
+uint coherenceDirectory::lookup(ulong block)
+{
+    unordered_map<ulong, uint>::iterator found = index.find(block);
+    if(found != index.end())
+    {
+        return found->second;
+    }
+
+    uint slot;
+    if(!freeSlots.empty())
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        memset(&pool[slot*entryWords], 0, entryWords*sizeof(ulong));
+    }
+    else
+    {
+        slot = (uint)(pool.size()/entryWords);
+        pool.resize(pool.size() + entryWords, 0);
+    }
+    index[block] = slot;
+
+    if(index.size() > peakEntries)
+    {
+        peakEntries = index.size();
+    }
+
+    return slot;
+}
+
+ulong coherenceDirectory::recipients(const ulong *entry, ulong procNum)
+{
+    ulong count = DIR_COUNT(entry[0]);
+    ulong loop_p;
+
+    if(params.org == DIR_FULL)
+    {
+        return count - ((entry[1 + procNum/64] >> (procNum%64)) & 1);
+    }
+
+    if(!(entry[0] & DIR_OVERFLOW))
+    {
+        for(loop_p=0; loop_p<count; loop_p++)
+        {
+            if(entry[1 + loop_p] == procNum)
+            {
+                return count - 1;
+            }
+        }
+        return count;
+    }
+
+    if(params.org == DIR_PTR_B)
+    {
+        return numProcs - 1;
+    }
+
+    /** Every Processor of a Marked Group, the Last Group May be Short */
+    ulong total = 0;
+    for(loop_p=0; loop_p<coarseBits; loop_p++)
+    {
+        if((entry[1 + loop_p/64] >> (loop_p%64)) & 1)
+        {
+            ulong first = loop_p*groupSize;
+            if(first < numProcs)
+            {
+                total += (numProcs - first < groupSize) ? numProcs - first : groupSize;
+            }
+        }
+    }
+    ulong own = procNum/groupSize;
+
+    return total - ((entry[1 + own/64] >> (own%64)) & 1);
+}
+
+long coherenceDirectory::addSharer(ulong *entry, ulong procNum, bool miss)
+{
+    ulong count = DIR_COUNT(entry[0]);
+    ulong loop_p;
+
+    if(params.org == DIR_FULL)
+    {
+        ulong bit = 1UL << (procNum%64);
+        if(!(entry[1 + procNum/64] & bit))
+        {
+            entry[1 + procNum/64] |= bit;
+            entry[0]++;
+        }
+        return -1;
+    }
+
+    if(entry[0] & DIR_OVERFLOW)
+    {
+        /** Only the Count Can Tell a New Sharer, a Miss, from One Already There */
+        entry[0] += miss;
+
+        /** A Broadcast Entry Names Everyone Already */
+        if(params.org == DIR_COARSE)
+        {
+            ulong group = procNum/groupSize;
+            entry[1 + group/64] |= 1UL << (group%64);
+        }
+        return -1;
+    }
+
+    for(loop_p=0; loop_p<count; loop_p++)
+    {
+        if(entry[1 + loop_p] == procNum)
+        {
+            return -1;
+        }
+    }
+
+    if(count < params.pointers)
+    {
+        entry[1 + count] = procNum;
+        entry[0]++;
+        return -1;
+    }
+
+    long victim = -1;
+    switch(params.org)
+    {
+        case DIR_PTR_B: entry[0] |= DIR_OVERFLOW;
+                        entry[0]++;
+                        break;
+
+        case DIR_PTR_NB:
+                        /** Oldest Pointer Makes Room, the Pointers Stay in Arrival Order */
+                        victim = (long)entry[1];
+                        memmove(&entry[1], &entry[2], (count - 1)*sizeof(ulong));
+                        entry[count] = procNum;
+                        break;
+
+        case DIR_COARSE:
+                        {
+                            ulong sharers[DIR_MAX_POINTERS + 1];
+                            memcpy(sharers, &entry[1], count*sizeof(ulong));
+                            sharers[count] = procNum;
+                            memset(&entry[1], 0, (entryWords - 1)*sizeof(ulong));
+                            for(loop_p=0; loop_p<=count; loop_p++)
+                            {
+                                ulong group = sharers[loop_p]/groupSize;
+                                entry[1 + group/64] |= 1UL << (group%64);
+                            }
+                            entry[0] |= DIR_OVERFLOW;
+                            entry[0]++;
+                        }
+                        break;
+
+        default:        break;
+    }
+
+    return victim;
+}
+
+long coherenceDirectory::request(ulong block, ulong procNum, bool invalidates, bool update, bool miss, bool exclusive,
+                                 ulong copies, long dirtyHolder, bool revision)
+{
+    uint slot = lookup(block);
+    ulong *entry = &pool[slot*entryWords];
+    ulong sent = 0;
+
+    requests++;
+    messages[MSG_REQUEST]++;
+
+    /** A Miss to a Block Another Cache Owns is Forwarded to the Owner, Which Sends the Data */
+    bool forwarded = miss && (entry[0] & DIR_OWNED) && (DIR_OWNER(entry[0]) != procNum);
+    messages[MSG_FORWARD] += forwarded;
+
+    /** Every Other Named Sharer Gets the Invalidation or Update and Acknowledges it, the Forward Already Invalidates the Owner */
+    if(invalidates || update)
+    {
+        ulong covered = invalidates && forwarded;
+        sent = recipients(entry, procNum) - covered;
+        assert(sent + covered >= copies);
+        messages[invalidates ? MSG_INVALIDATION : MSG_UPDATE] += sent;
+        messages[MSG_ACK] += sent;
+        extraMessages += sent + covered - copies;
+        if((sent > 0) && (entry[0] & DIR_OVERFLOW))
+        {
+            overflowed++;
+        }
+    }
+
+    /** The Block Reaches a Missing Requester from the Owner or Home, a Hit Gets a Grant */
+    messages[miss ? MSG_DATA : MSG_ACK]++;
+
+    /** An Owner Giving Up its Dirty Copy to a Reader Writes it Back to Home */
+    ulong total = 2 + forwarded + 2*sent;
+    if(forwarded && !invalidates && revision)
+    {
+        messages[MSG_WRITEBACK]++;
+        total++;
+    }
+
+    long victim = -1;
+    if(invalidates)
+    {
+        /** Once Acknowledged Only the Requester Holds the Block */
+        memset(entry, 0, entryWords*sizeof(ulong));
+        addSharer(entry, procNum, true);
+    }
+    else
+    {
+        victim = addSharer(entry, procNum, miss);
+    }
+
+    /** A Writer or an Exclusive Reader Owns the Block, Otherwise a Cache Still Holding it Dirty Does */
+    if(invalidates || update || exclusive)
+    {
+        entry[0] = setOwner(entry[0], procNum);
+    }
+    else if(dirtyHolder >= 0)
+    {
+        entry[0] = setOwner(entry[0], (ulong)dirtyHolder);
+    }
+    else
+    {
+        entry[0] &= ~DIR_OWNED;
+    }
+
+    if(victim >= 0)
+    {
+        /** A Recalled Owner Writes its Copy Back, Leaving Home Up to Date */
+        if((entry[0] & DIR_OWNED) && (DIR_OWNER(entry[0]) == (ulong)victim))
+        {
+            entry[0] &= ~DIR_OWNED;
+        }
+        recalls++;
+        messages[MSG_INVALIDATION]++;
+        messages[MSG_ACK]++;
+        total += 2;
+    }
+    if(total > maxMessages)
+    {
+        maxMessages = total;
+    }
+
+    /** Request then Reply, with a Forward or Sharer Round in the Middle */
+    hops += (forwarded || (sent > 0)) ? 3 : 2;
+
+    return victim;
+}
+
+void coherenceDirectory::evicted(ulong block, ulong procNum, bool dirty)
+{
+    messages[dirty ? MSG_WRITEBACK : MSG_HINT]++;
+
+    unordered_map<ulong, uint>::iterator found = index.find(block);
+    if(found == index.end())
+    {
+        return;
+    }
+    ulong *entry = &pool[found->second*entryWords];
+    ulong count = DIR_COUNT(entry[0]);
+    ulong loop_p;
+
+    /** A Departing Owner Leaves Home's Copy, Written Back if it was Dirty, as the Up to Date One */
+    if((entry[0] & DIR_OWNED) && (DIR_OWNER(entry[0]) == procNum))
+    {
+        entry[0] &= ~DIR_OWNED;
+    }
+
+    if(params.org == DIR_FULL)
+    {
+        ulong bit = 1UL << (procNum%64);
+        if(entry[1 + procNum/64] & bit)
+        {
+            entry[1 + procNum/64] &= ~bit;
+            entry[0]--;
+        }
+    }
+    else if(!(entry[0] & DIR_OVERFLOW))
+    {
+        for(loop_p=0; loop_p<count; loop_p++)
+        {
+            if(entry[1 + loop_p] == procNum)
+            {
+                memmove(&entry[1 + loop_p], &entry[2 + loop_p], (count - 1 - loop_p)*sizeof(ulong));
+                entry[0]--;
+                break;
+            }
+        }
+    }
+    else
+    {
+        /** An Overflowed Entry Cannot Tell Which Sharer Left, Only How Many Remain */
+        assert(count > 0);
+        entry[0]--;
+    }
+
+    if(DIR_COUNT(entry[0]) == 0)
+    {
+        freeSlots.push_back(found->second);
+        index.erase(found);
+    }
+}
+
+void coherenceDirectory::dumpStats(ulong busTransactions)
+{
+    static const char *names[NUM_DIR_MESSAGES] = {"requests", "forwards", "invalidations", "updates",
+                                                  "acks", "data", "writebacks", "hints"};
+    ulong entryBits = 0;
+    ulong total = 0;
+    ulong loop_m;
+
+    /** Entries that Can Overflow Add an Overflow Bit and a Sharer Count of Up to numProcs */
+    printf("============ Directory (");
+    switch(params.org)
+    {
+        case DIR_FULL:      printf("full map");
+                            entryBits = numProcs;
+                            break;
+
+        case DIR_PTR_B:     printf("Dir%u_B", params.pointers);
+                            entryBits = params.pointers*pointerBits + 1 + pointerBits + 1;
+                            break;
+
+        case DIR_PTR_NB:    printf("Dir%u_NB", params.pointers);
+                            entryBits = params.pointers*pointerBits;
+                            break;
+
+        case DIR_COARSE:    printf("Dir%u_CV, %lu processors per bit", params.pointers, groupSize);
+                            entryBits = params.pointers*pointerBits + 1 + pointerBits + 1;
+                            break;
+
+        default:            break;
+    }
+    printf(") ============\n");
+
+    /** Every Organization Also Keeps an Owned Bit, the Owner is a Pointer Unless it is the Only Sharer */
+    entryBits += 1 + pointerBits;
+
+    printf("entry: %lu bits, %.2f%% of a %lu byte block\n", entryBits, (double)entryBits*100.0/(blockBytes*8), blockBytes);
+    printf("peak entries: %lu, %.1f KB as a sparse directory\n", peakEntries, (double)peakEntries*entryBits/8.0/1024.0);
+
+    for(loop_m=0; loop_m<NUM_DIR_MESSAGES; loop_m++)
+    {
+        printf("%s %lu%s", names[loop_m], messages[loop_m], (loop_m + 1 < NUM_DIR_MESSAGES) ? ", " : "\n");
+        total += messages[loop_m];
+    }
+    printf("total messages:                 \t%lu\n", total);
+    printf("messages per request:           \t%.2f (max %lu)\n", requests ? (double)(total - messages[MSG_WRITEBACK] - messages[MSG_HINT])/requests : 0.0, maxMessages);
+    printf("critical path per request:      \t%.2f hops\n", requests ? (double)hops/requests : 0.0);
+    printf("requests to overflowed entries: \t%lu\n", overflowed);
+    printf("messages to caches without copy:\t%lu\n", extraMessages);
+    printf("copies recalled for a pointer:  \t%lu\n", recalls);
+    printf("snooping bus: %lu transactions, each snooped by %lu caches\n", busTransactions, numProcs - 1);
+}
@@ -0,0 +1,224 @@
+/**
+ * \file directory.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Directory Based Coherence Message and Storage Model
+ */
+
+#ifndef __DIRECTORY_H__
+#define __DIRECTORY_H__
+
+#include <unordered_map>
+#include <vector>
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/** Type define unsigned int as uint */
+typedef unsigned int uint;
+
+/** Most Pointers of a Limited Pointer Entry */
+#define DIR_MAX_POINTERS 64
+
+/** Directory Organization Enumeration */
+enum dirOrganization    {
+                            DIR_NONE =      0,  /**< No Directory, Snooping Bus Only */
+                            DIR_FULL =      1,  /**< Full Map, a Presence Bit per Processor */
+                            DIR_PTR_B =     2,  /**< Dir_i_B, i Pointers, Broadcast Once They Overflow */
+                            DIR_PTR_NB =    3,  /**< Dir_i_NB, i Pointers, a Sharer is Invalidated to Make Room */
+                            DIR_COARSE =    4   /**< Dir_i_CV, i Pointers, a Coarse Vector of Processor Groups Once They Overflow */
+};
+
+/** Point to Point Message Type Enumeration */
+enum dirMessage     {
+                        MSG_REQUEST =       0,  /**< Requester to Home */
+                        MSG_FORWARD =       1,  /**< Home to the Cache Supplying the Block */
+                        MSG_INVALIDATION =  2,  /**< Home to a Sharer */
+                        MSG_UPDATE =        3,  /**< Home to a Sharer, Carrying a Dragon Update Word */
+                        MSG_ACK =           4,  /**< Sharer to Requester, or Home's Grant Without Data */
+                        MSG_DATA =          5,  /**< Block to the Requester, from Home or the Supplying Cache */
+                        MSG_WRITEBACK =     6,  /**< Dirty Block Back to Home */
+                        MSG_HINT =          7,  /**< Clean Replacement Notice to Home */
+                        NUM_DIR_MESSAGES =  8
+};
+
+/**
+ * \struct directoryParams
+ * \brief Directory Organization
+ */
+struct directoryParams
+{
+    enum dirOrganization org;   /**< Organization, DIR_NONE for a Snooping Run */
+    uint pointers;              /**< Pointers i of a Limited Pointer Entry */
+
+    /**
+     * \brief directoryParams Constructor, No Directory
+     */
+    directoryParams()
+    {
+        org = DIR_NONE;
+        pointers = 0;
+    }
+};
+
+/**
+ * \brief Parse "full", "dir<i>b", "dir<i>nb" or "dir<i>cv"
+ * \param[in] text Organization Name
+ * \param[out] params Directory Organization
+ * \return Whether the Text was Valid
+ */
+bool parseDirectoryParams(const char *text, directoryParams &params);
+
+/**
+ * \class coherenceDirectory
+ * \brief Class Counting the Messages a Directory Protocol Would Send
+ *
+ * The controller walks the protocol table exactly as on the bus, so cache
+ * states and counters do not depend on the organization, and reports each
+ * transaction here. The directory keeps its own entry per cached block and
+ * sends invalidations and updates to every processor the entry names, which
+ * may be more than hold a copy once a limited entry overflows: Dir_i_B then
+ * names every processor and Dir_i_CV every processor of a marked group.
+ * Dir_i_NB never overflows, it evicts its oldest pointer instead and the
+ * controller invalidates that sharer's copy.
+ *
+ * Caches send a replacement hint or writeback on every eviction, so a
+ * pointer entry is exact. An overflowed entry still counts its sharers,
+ * adding one on each miss and dropping one on each eviction, and is freed
+ * once the count reaches zero. An entry names only the requester again
+ * after its invalidations are acknowledged.
+ *
+ * An entry also records the cache owning the block: a writer, an updater
+ * or a reader granted an exclusive copy, and then whichever cache still
+ * holds it dirty after a read. A miss to an owned block is forwarded to
+ * the owner, which supplies the data, and an owner giving up a dirty copy
+ * to a reader writes it back to home. The owner is forgotten when it
+ * evicts the block. Forwards and hops therefore follow the entry, not
+ * which caches the bus protocol lets supply a block.
+ */
+class coherenceDirectory
+{
+protected:
+    directoryParams params;                     /**< Organization */
+    ulong numProcs;                             /**< Number of Processors */
+    ulong blockBytes;                           /**< Cache Block Size */
+    ulong pointerBits;                          /**< Bits of a Processor Number */
+    ulong coarseBits;                           /**< Bits of a Coarse Vector */
+    ulong groupSize;                            /**< Processors per Coarse Vector Bit */
+    ulong entryWords;                           /**< Words of an Entry, a Count and Overflow Word First */
+    std::unordered_map<ulong, uint> index;      /**< Entry Slot of Each Tracked Block */
+    std::vector<ulong> pool;                    /**< Entries, entryWords Words Each */
+    std::vector<uint> freeSlots;                /**< Slots of Entries Released */
+    ulong peakEntries;                          /**< Most Blocks Tracked at Once */
+
+    ulong messages[NUM_DIR_MESSAGES];           /**< Messages Sent, by Type */
+    ulong requests;                             /**< Request Transactions */
+    ulong hops;                                 /**< Critical Path Hops Summed over Requests */
+    ulong maxMessages;                          /**< Most Messages of One Request */
+    ulong overflowed;                           /**< Requests Sending to an Overflowed Entry */
+    ulong extraMessages;                        /**< Invalidations and Updates to Processors Without a Copy */
+    ulong recalls;                              /**< Copies Invalidated to Free a Dir_i_NB Pointer */
+
+    /**
+     * \brief Get the Entry Slot of a Block, Allocating an Empty Entry if Untracked
+     * \param[in] block Block Address
+     * \return Entry Slot
+     */
+    uint lookup(ulong block);
+
+    /**
+     * \brief Count the Processors Other Than One an Entry Names
+     * \param[in] entry Entry Words
+     * \param[in] procNum Processor Left Out
+     * \return Recipients of an Invalidation or Update
+     */
+    ulong recipients(const ulong *entry, ulong procNum);
+
+    /**
+     * \brief Add a Sharer to an Entry
+     * \param[in,out] entry Entry Words
+     * \param[in] procNum New Sharer
+     * \param[in] miss Whether the Sharer Had No Copy, Counted Even Once the Entry Overflowed
+     * \return Processor Whose Pointer was Evicted, -1 for None
+     */
+    long addSharer(ulong *entry, ulong procNum, bool miss);
+
+public:
+
+    /**
+     * \brief coherenceDirectory Class Constructor
+     * \param[in] p Directory Organization
+     * \param[in] numP Number of Processors
+     * \param[in] blockSize Cache Block Size
+     */
+    coherenceDirectory(const directoryParams &p, int numP, ulong blockSize);
+
+    /**
+     * \brief Report a Request Transaction, After Every Copy was Snooped
+     * \param[in] block Block Address
+     * \param[in] procNum Requesting Processor
+     * \param[in] invalidates Whether the Command Invalidates Other Copies
+     * \param[in] update Whether the Command Carries an Update Word to Other Copies
+     * \param[in] miss Whether the Requester Needs the Block, Not Only Permission
+     * \param[in] exclusive Whether the Requester's New State Lets it Write Without a Request
+     * \param[in] copies Other Caches Holding the Block
+     * \param[in] dirtyHolder Other Cache Left Holding the Block Dirty, -1 for None
+     * \param[in] revision Whether a Snooped Copy was Written Back
+     * \return Processor Whose Copy Must be Invalidated to Free a Pointer, -1 for None
+     */
+    long request(ulong block, ulong procNum, bool invalidates, bool update, bool miss, bool exclusive,
+                 ulong copies, long dirtyHolder, bool revision);
+
+    /**
+     * \brief Report the Copy Invalidated for a Pointer request Returned
+     * \param[in] dirty Whether the Copy was Written Back with its Acknowledgement
+     */
+    void recalled(bool dirty)
+    {
+        messages[MSG_WRITEBACK] += dirty;
+    }
+
+    /**
+     * \brief Report a Block Leaving a Cache on Replacement
+     * \param[in] block Block Address
+     * \param[in] procNum Processor Evicting the Block
+     * \param[in] dirty Whether the Block is Written Back
+     */
+    void evicted(ulong block, ulong procNum, bool dirty);
+
+    /**
+     * \brief Get the Messages Sent of One Type
+     * \param[in] type Message Type
+     * \return Messages Sent
+     */
+    ulong getMessages(enum dirMessage type)
+    {
+        return messages[type];
+    }
+
+    /**
+     * \brief Get the Critical Path Hops Summed over Requests
+     * \return Hops
+     */
+    ulong getHops()
+    {
+        return hops;
+    }
+
+    /**
+     * \brief Get the Number of Blocks Tracked Now
+     * \return Live Entries
+     */
+    ulong getEntries()
+    {
+        return index.size();
+    }
+
+    /**
+     * \brief Print the Message Counts and the Directory Storage Overhead
+     * \param[in] busTransactions Bus Commands the Same Run Issues on a Snooping Bus
+     */
+    void dumpStats(ulong busTransactions);
+};
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * \file directory_test.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Directory Message Counts of Hand Written Traces, Checked per Organization
+ *
+ * Runs short MSI and MOESI traces on 4 processors with 256 byte direct
+ * mapped caches of 64 byte blocks, so blocks 0x000, 0x100 and 0x200 share
+ * a set, and compares the messages, hops and live entries of every
+ * organization against counts worked out by hand. With one pointer, the
+ * second sharer overflows Dir1_B and Dir1_CV and recalls the first under
+ * Dir1_NB. The MOESI trace forwards misses to Owned and Exclusive copies
+ * and has Dir1_NB recall the owner itself.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "coherence_ctrl.h"
+#include "directory.h"
+#include "trace_reader.h"
+
+/** Hand Written MSI Trace, Addresses 0x000 (X), 0x100 (Y) and 0x200 (Z) Conflict, 0x040 (W) Does Not */
+static const traceRecord msiTrace[] = {
+    {0x000, 0, 0},      /**< P0 Reads X from Home */
+    {0x000, 1, 0},      /**< P1 Reads X, Overflowing a Single Pointer */
+    {0x000, 2, 1},      /**< P2 Writes X, Invalidating Every Named Sharer, and Owns it */
+    {0x000, 3, 0},      /**< P3 Reads X, Forwarded to P2, Which Writes Back */
+    {0x100, 3, 0},      /**< P3 Evicts X with a Hint and Reads Y */
+    {0x200, 2, 0},      /**< P2 Evicts X with a Hint, its Entry Drains, and Reads Z */
+    {0x000, 0, 1},      /**< P0 Writes X, a Fresh Entry Sends Nothing */
+    {0x040, 0, 0},      /**< P0 Reads W */
+    {0x040, 2, 0},      /**< P2 Reads W, P0 and P2 Sit in Different Coarse Groups */
+    {0x040, 3, 1}       /**< P3 Writes W, Invalidating Every Named Sharer */
+};
+
+/** Hand Written MOESI Trace, Same Addresses */
+static const traceRecord moesiTrace[] = {
+    {0x000, 0, 1},      /**< P0 Writes X and Owns it */
+    {0x000, 1, 0},      /**< P1 Reads X, Forwarded to P0, Which Keeps it Owned, Dir1_NB Recalls P0 */
+    {0x000, 2, 0},      /**< P2 Reads X, Forwarded to P0 Unless it was Recalled */
+    {0x000, 1, 1},      /**< P1 Upgrades X, a Miss Under Dir1_NB, and Owns it */
+    {0x000, 3, 0},      /**< P3 Reads X, Forwarded to P1, Dir1_NB Recalls the Owner */
+    {0x040, 0, 0},      /**< P0 Reads W Exclusive and Owns it */
+    {0x040, 2, 0},      /**< P2 Reads W, Forwarded to P0, Now Nobody Owns it */
+    {0x100, 1, 0},      /**< P1 Writes Back X Unless it was Recalled, Reads Y Exclusive */
+    {0x100, 3, 0}       /**< P3 Evicts X with a Hint, its Entry Drains, and Reads Y from P1 */
+};
+
+/**
+ * \struct directoryExpect
+ * \brief Counts Worked Out by Hand for One Organization
+ */
+struct directoryExpect
+{
+    const char *org;                    /**< Organization Name as Given to --directory */
+    ulong messages[NUM_DIR_MESSAGES];   /**< Messages Sent, by Type */
+    ulong hops;                         /**< Critical Path Hops Summed over Requests */
+    ulong entries;                      /**< Blocks Tracked After the Trace */
+};
+
+/** Number of Organizations Checked per Trace */
+#define NUM_TEST_ORGS 4
+
+static const directoryExpect msiExpected[NUM_TEST_ORGS] = {
+    /**                  req fwd inv upd ack data wb hint */
+    {"full",            {10, 1,  4,  0,  4,  10,  1, 2},    23, 4},
+    {"dir1b",           {10, 1,  6,  0,  6,  10,  1, 2},    23, 4},
+    {"dir1nb",          {10, 1,  5,  0,  5,  10,  1, 1},    23, 4},
+    {"dir1cv",          {10, 1,  5,  0,  5,  10,  1, 2},    23, 4}
+};
+
+static const directoryExpect moesiExpected[NUM_TEST_ORGS] = {
+    /**                  req fwd inv upd ack data wb hint */
+    {"full",            {9,  5,  2,  0,  3,  8,   1, 1},    24, 2},
+    {"dir1b",           {9,  5,  3,  0,  4,  8,   1, 1},    24, 2},
+    {"dir1nb",          {9,  4,  6,  0,  6,  9,   2, 1},    23, 2},
+    {"dir1cv",          {9,  5,  3,  0,  4,  8,   1, 1},    24, 2}
+};
+
+/**
+ * \brief Run a Trace Through One Organization and Compare the Counts
+ * \param[in] protocol Coherence Protocol
+ * \param[in] trace Hand Written Trace
+ * \param[in] numRecords Records in the Trace
+ * \param[in] expect Counts Worked Out by Hand
+ * \return Number of Mismatching Counts
+ */
+static int checkRun(enum coh_protocol protocol, const traceRecord *trace, ulong numRecords, const directoryExpect &expect)
+{
+    static const char *names[NUM_DIR_MESSAGES] = {"requests", "forwards", "invalidations", "updates",
+                                                  "acks", "data", "writebacks", "hints"};
+    const char *protocolName = getProtocolName(protocol);
+    int mismatches = 0;
+    ulong loop_m;
+
+    directoryParams params;
+    if(!parseDirectoryParams(expect.org, params))
+    {
+        printf("FAIL %s %s: not an organization\n", protocolName, expect.org);
+        return 1;
+    }
+
+    coherenceController *ctrl = createController(256, 1, 64, 4, protocol);
+    ctrl->enableDirectory(params);
+    ctrl->processBatch(trace, numRecords);
+    coherenceDirectory *directory = ctrl->getDirectory();
+
+    for(loop_m=0; loop_m<NUM_DIR_MESSAGES; loop_m++)
+    {
+        ulong got = directory->getMessages((enum dirMessage)loop_m);
+        if(got != expect.messages[loop_m])
+        {
+            printf("FAIL %s %s: %s %lu, expected %lu\n", protocolName, expect.org, names[loop_m], got, expect.messages[loop_m]);
+            mismatches++;
+        }
+    }
+    if(directory->getHops() != expect.hops)
+    {
+        printf("FAIL %s %s: hops %lu, expected %lu\n", protocolName, expect.org, directory->getHops(), expect.hops);
+        mismatches++;
+    }
+    if(directory->getEntries() != expect.entries)
+    {
+        printf("FAIL %s %s: entries %lu, expected %lu\n", protocolName, expect.org, directory->getEntries(), expect.entries);
+        mismatches++;
+    }
+
+    if(mismatches == 0)
+    {
+        printf("ok %s %s\n", protocolName, expect.org);
+    }
+    delete ctrl;
+
+    return mismatches;
+}
+
+int main()
+{
+    int failures = 0;
+    int loop_o;
+
+    for(loop_o=0; loop_o<NUM_TEST_ORGS; loop_o++)
+    {
+        failures += checkRun(MSI, msiTrace, sizeof(msiTrace)/sizeof(msiTrace[0]), msiExpected[loop_o]);
+    }
+    for(loop_o=0; loop_o<NUM_TEST_ORGS; loop_o++)
+    {
+        failures += checkRun(MOESI, moesiTrace, sizeof(moesiTrace)/sizeof(moesiTrace[0]), moesiExpected[loop_o]);
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+/**
+ * \file interval_stats.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Interval (Time Series) Statistics Sampling
+ */
+
+#include "interval_stats.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool parseIntervalParams(const char *text, intervalParams &params)
+{
+    if(strncmp(text, "refs:", 5) == 0)
+    {
+        params.kind = INTERVAL_REFS;
+        text += 5;
+    }
+    else if(strncmp(text, "bus:", 4) == 0)
+    {
+        params.kind = INTERVAL_BUS;
+        text += 4;
+    }
+
+    char *end;
+    params.length = strtoul(text, &end, 10);
+
+    return (end != text) && (*end == '\0') && (params.length > 0);
+}
+
+intervalSampler::intervalSampler(const intervalParams &p, int numP)
+{
+    ulong words = (ulong)numP*NUM_CACHE_COUNTERS;
+    int loop_c;
+
+    params = p;
+    numProcessors = numP;
+    blocks[0] = new ulong[words]();
+    blocks[1] = new ulong[words]();
+    front = 0;
+    refs = 0;
+    next = params.length;
+    lastRefs = 0;
+    intervals = 0;
+
+    out = fopen(params.fileName, "w");
+    if(out != NULL)
+    {
+        fprintf(out, "interval,refs,bus_transactions,cache");
+        for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+        {
+            fprintf(out, ",%s", getCounterName((enum cacheCounter)loop_c));
+        }
+        fprintf(out, "\n");
+    }
+}
+
+intervalSampler::~intervalSampler()
+{
+    if(out != NULL)
+    {
+        fclose(out);
+    }
+    delete [] blocks[0];
+    delete [] blocks[1];
+}
+
+void intervalSampler::sample(Cache **caches, ulong busTransactions)
+{
+    const ulong *start = blocks[front];
+    ulong *end = blocks[front ^ 1];
+    int loop_i, loop_c;
+
+    for(loop_i=0; loop_i<numProcessors; loop_i++)
+    {
+        ulong *snap = &end[(ulong)loop_i*NUM_CACHE_COUNTERS];
+        const ulong *prev = &start[(ulong)loop_i*NUM_CACHE_COUNTERS];
+
+        for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+        {
+            snap[loop_c] = caches[loop_i]->getCounter((enum cacheCounter)loop_c);
+        }
+
+        fprintf(out, "%lu,%lu,%lu,%d", intervals, refs, busTransactions, loop_i);
+        for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+        {
+            fprintf(out, ",%lu", snap[loop_c] - prev[loop_c]);
+        }
+        fprintf(out, "\n");
+    }
+
+    front ^= 1;
+    intervals++;
+    lastRefs = refs;
+
+    /** A Reference Can End Several Bus Intervals, they Merge into One Row */
+    ulong reached = (params.kind == INTERVAL_REFS) ? refs : busTransactions;
+    while(next <= reached)
+    {
+        next += params.length;
+    }
+}
+
+void intervalSampler::finish(Cache **caches, ulong busTransactions)
+{
+    if(refs > lastRefs)
+    {
+        sample(caches, busTransactions);
+    }
+    fflush(out);
+}
@@ -0,0 +1,126 @@
+/**
+ * \file interval_stats.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Interval (Time Series) Statistics Sampling
+ */
+
+#ifndef __INTERVAL_STATS_H__
+#define __INTERVAL_STATS_H__
+
+#include <stdio.h>
+
+#include "cache.h"
+
+/** Interval Length Unit Enumeration */
+enum intervalKind   {
+                        INTERVAL_REFS = 0,  /**< Every N Trace References */
+                        INTERVAL_BUS =  1   /**< Every N Bus Transactions, Writebacks Included */
+};
+
+/**
+ * \struct intervalParams
+ * \brief Interval Length and Destination of the Samples
+ */
+struct intervalParams
+{
+    enum intervalKind kind;     /**< Unit of the Interval Length */
+    ulong length;               /**< Interval Length, 0 to Not Sample */
+    const char *fileName;       /**< File the Interval Rows are Written to */
+
+    /**
+     * \brief intervalParams Constructor, Sampling Off
+     */
+    intervalParams()
+    {
+        kind = INTERVAL_REFS;
+        length = 0;
+        fileName = "intervals.csv";
+    }
+};
+
+/**
+ * \brief Parse an Interval Length, "<n>", "refs:<n>" or "bus:<n>"
+ * \param[in] text Interval Length
+ * \param[in,out] params Interval Parameters
+ * \return Whether the Text was Valid
+ */
+bool parseIntervalParams(const char *text, intervalParams &params);
+
+/**
+ * \class intervalSampler
+ * \brief Class Writing the Counter Deltas of Every Interval of a Run
+ *
+ * Two counter blocks hold the snapshot at the start of the current
+ * interval and the one being taken at its end. A sample copies every
+ * cache's counters into the back block, writes the difference to the
+ * front block, and swaps the two, so no counter is reset and the hot path
+ * only compares a count against the next boundary.
+ *
+ * Each interval is written as one CSV row per cache: the interval number,
+ * the references and bus transactions at its end, then every counter's
+ * change over the interval.
+ */
+class intervalSampler
+{
+protected:
+    intervalParams params;      /**< Interval Length and File Name */
+    int numProcessors;          /**< Number of Caches Sampled */
+    FILE *out;                  /**< Interval Rows */
+    ulong *blocks[2];           /**< Counter Snapshots, [cache*NUM_CACHE_COUNTERS + counter] */
+    int front;                  /**< Block Holding the Snapshot at the Start of the Interval */
+    ulong refs;                 /**< References Seen */
+    ulong next;                 /**< References or Bus Transactions Ending the Interval */
+    ulong lastRefs;             /**< References at the Last Sample */
+    ulong intervals;            /**< Intervals Written */
+
+public:
+
+    /**
+     * \brief intervalSampler Class Constructor, Check isOpen Before Use
+     * \param[in] p Interval Length and File Name
+     * \param[in] numP Number of Caches
+     */
+    intervalSampler(const intervalParams &p, int numP);
+
+    /**
+     * \brief intervalSampler Class Destructor, Closes the File
+     */
+    ~intervalSampler();
+
+    /**
+     * \brief Whether the Interval File Could be Created
+     * \return Whether Samples Can be Written
+     */
+    bool isOpen()
+    {
+        return (out != NULL);
+    }
+
+    /**
+     * \brief Count One Reference and Check for the End of the Interval
+     * \param[in] busTransactions Bus Transactions So Far
+     * \return Whether sample Should be Called
+     */
+    bool due(ulong busTransactions)
+    {
+        refs++;
+        return (((params.kind == INTERVAL_REFS) ? refs : busTransactions) >= next);
+    }
+
+    /**
+     * \brief Write the Counter Deltas of the Interval Just Ended
+     * \param[in] caches Cache of Every Processor
+     * \param[in] busTransactions Bus Transactions So Far
+     */
+    void sample(Cache **caches, ulong busTransactions);
+
+    /**
+     * \brief Write the Last, Partial Interval, if it Saw Any Reference
+     * \param[in] caches Cache of Every Processor
+     * \param[in] busTransactions Bus Transactions So Far
+     */
+    void finish(Cache **caches, ulong busTransactions);
+};
+
+#endif
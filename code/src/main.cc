@@ -6,25 +6,115 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <fstream>
+#include <vector>
 using namespace std;
 
 #include "cache.h"
 #include "coherence_ctrl.h"
+#include "trace_reader.h"
+#include "sweep.h"
+#include "sim_options.h"
+#include "shard_sim.h"
+#include "pipeline.h"
 
 int main(int argc, char *argv[])
 {
 	
 	ifstream fin;
-	FILE *pFile;
+	traceReader trace;
         
         enum coh_protocol currentProtocol;
 
-	if(argv[1] == NULL)
+        /** Leading --options, the Positional Arguments Follow Them */
+        simOptions opts;
+        int argi = parseOptions(argc, argv, opts);
+        if(argi < 0)
         {
-		 printf("input format: ");
-		 printf("./smp_cache <cache_size> <assoc> <block_size> <num_processors> <protocol> <trace_file> \n");
+            printUsage();
+            exit(0);
+        }
+        argv += argi - 1;
+        argc -= argi - 1;
+
+        /** The Timing Model Needs Every Access of a Single Run in Trace Order */
+        if(opts.timing && ((opts.sweepFile != NULL) || (opts.numShards != 1)))
+        {
+            printf("--timing is not supported with --sweep or --shards\n");
+            exit(0);
+        }
+        
+        /** A Sweep Decodes the Trace Once for Every Configuration, Each Built with Private Tags */
+        if(((opts.pipelineRing > 0) || (opts.layout != LAYOUT_PRIVATE)) && (opts.sweepFile != NULL))
+        {
+            printf("--pipeline and --layout are not supported with --sweep\n");
+            exit(0);
+        }
+        
+        /** A Sharded Run Decodes on its Own Dispatcher Thread Already */
+        if((opts.pipelineRing > 0) && (opts.numShards != 1))
+        {
+            printf("--pipeline is not supported with --shards\n");
+            exit(0);
+        }
+        
+        /** Intervals Follow the References of One Run in Trace Order */
+        if((opts.intervals.length > 0) && ((opts.sweepFile != NULL) || (opts.numShards != 1)))
+        {
+            printf("--interval is not supported with --sweep or --shards\n");
+            exit(0);
+        }
+        
+        /** One Profile Sees Every Block of One Run */
+        if((opts.profile.entries > 0) && ((opts.sweepFile != NULL) || (opts.numShards != 1)))
+        {
+            printf("--profile is not supported with --sweep or --shards\n");
+            exit(0);
+        }
+        
+        /** One Directory Sees Every Block of One Run, its Messages are Not Timed on the Bus */
+        if((opts.directory.org != DIR_NONE) && ((opts.sweepFile != NULL) || (opts.numShards != 1) || opts.timing))
+        {
+            printf("--directory is not supported with --sweep, --shards or --timing\n");
+            exit(0);
+        }
+        
+        /** Timing Statistics and the Sharing Profile Have No Structured Form */
+        if((opts.timing || (opts.profile.entries > 0) || (opts.directory.org != DIR_NONE)) && (opts.format != FORMAT_TEXT))
+        {
+            printf("--timing, --profile and --directory are not supported with --format=json or --format=csv\n");
+            exit(0);
+        }
+
+        /** Sweep Mode: Every Configuration in the File from One Pass over the Trace */
+        if(opts.sweepFile != NULL)
+        {
+            vector<sweepConfig> configs;
+            
+            if((argc < 2) || !loadSweepConfigs(opts.sweepFile, configs, opts.repl))
+            {
+                printUsage();
+                exit(0);
+            }
+            
+            if(!trace.open(argv[1]))
+            {
+                printf("Trace file problem\n");
+                exit(0);
+            }
+            
+            if(opts.numThreads == 1)
+            {
+                return runSweep(configs, trace, opts.traffic, opts.format, argv[1]);
+            }
+            return runParallelSweep(configs, trace, opts.numThreads, opts.traffic, opts.format, argv[1]);
+        }
+
+	if(argc < 7)
+        {
+		 printUsage();
 		 exit(0);
         }
 
@@ -32,15 +122,18 @@ int main(int argc, char *argv[])
 	int cache_assoc= atoi(argv[2]);
 	int blk_size   = atoi(argv[3]);
 	int num_processors = atoi(argv[4]);/*1, 2, 4, 8*/
-	int protocol   = atoi(argv[5]);	 /*0:MSI, 1:MESI, 2:Dragon*/
+	int protocol   = atoi(argv[5]);	 /*0:MSI, 1:MESI, 2:Dragon, 3:MOESI, 4:MESIF*/
 	char *fname =  (char *)malloc(20);
  	fname = argv[6];
 
         /** Personal Information to stdout */
-	printf("===== 506 Personal information =====\n");
-        printf("Soumil Krishnanand Heble\n");
-        printf("sheble\n");
-        printf("ECE492 Students? NO\n");
+        if(opts.format == FORMAT_TEXT)
+        {
+            printf("===== 506 Personal information =====\n");
+            printf("Soumil Krishnanand Heble\n");
+            printf("sheble\n");
+            printf("ECE492 Students? NO\n");
+        }
         
         switch(protocol)
         {
@@ -53,69 +146,159 @@ int main(int argc, char *argv[])
             case 2: currentProtocol = DRAGON;
                     break;
                     
+            case 3: currentProtocol = MOESI;
+                    break;
+                    
+            case 4: currentProtocol = MESIF;
+                    break;
+                    
             default:    printf("COHERENCE PROTOCOL: UNKNOWN, Wrong Argument\n");
                         exit(0);
         }
 
-        /** Create Coherence Controller Class Object Here with Constructor */
-        coherenceController simController = coherenceController(cache_size, cache_assoc, blk_size, num_processors, currentProtocol);
+        /** Create the Coherence Controller Specialized for the Protocol */
+        coherenceController *simController = createController(cache_size, cache_assoc, blk_size, num_processors, currentProtocol, opts.repl, opts.layout);
+        simController->setTraffic(opts.traffic);
+        if(opts.timing)
+        {
+            simController->enableTiming(opts.latencies);
+        }
+        if(opts.profile.entries > 0)
+        {
+            simController->enableProfiler(opts.profile);
+        }
+        if(opts.directory.org != DIR_NONE)
+        {
+            simController->enableDirectory(opts.directory);
+        }
+        if((opts.intervals.length > 0) && !simController->enableIntervals(opts.intervals))
+        {
+            printf("Interval file problem: %s\n", opts.intervals.fileName);
+            exit(0);
+        }
 
-	pFile = fopen (fname,"r");
-	if(pFile == 0)
+	if(!trace.open(fname))
 	{   
 		printf("Trace file problem\n");
 		exit(0);
 	}
 	
+	/** A Binary Trace Declares its Processor Count, Reject a Mismatch Up Front */
+	if(trace.getNumProcessors() > (uint)num_processors)
+	{
+		printf("Trace file problem: trace has %u processors\n", trace.getNumProcessors());
+		exit(0);
+	}
+	trace.setProcessorLimit((ulong)num_processors);
+	
 	/** Print Simulation Parameters and Cache Specifications */
-	printf("===== 506 SMP Simulator configuration =====\n");
-        printf("L1_SIZE: %d\n", cache_size);
-        printf("L1_ASSOC: %d\n", cache_assoc);
-        printf("L1_BLOCKSIZE: %d\n", blk_size);
-        printf("NUMBER OF PROCESSORS: %d\n", num_processors);
-        
-        switch(protocol)
+        if(opts.format == FORMAT_TEXT)
         {
-            case 0: printf("COHERENCE PROTOCOL: MSI\n");
-                    break;
+            printf("===== 506 SMP Simulator configuration =====\n");
+            printf("L1_SIZE: %d\n", cache_size);
+            printf("L1_ASSOC: %d\n", cache_assoc);
+            printf("L1_BLOCKSIZE: %d\n", blk_size);
+            printf("NUMBER OF PROCESSORS: %d\n", num_processors);
+        
+            switch(protocol)
+            {
+                case 0: printf("COHERENCE PROTOCOL: MSI\n");
+                        break;
                     
-            case 1: printf("COHERENCE PROTOCOL: MESI\n");
-                    break;
+                case 1: printf("COHERENCE PROTOCOL: MESI\n");
+                        break;
                     
-            case 2: printf("COHERENCE PROTOCOL: Dragon\n");
-                    break;
+                case 2: printf("COHERENCE PROTOCOL: Dragon\n");
+                        break;
                     
-            default:    printf("COHERENCE PROTOCOL: UNKNOWN, Wrong Argument\n");
+                case 3: printf("COHERENCE PROTOCOL: MOESI\n");
+                        break;
+                    
+                case 4: printf("COHERENCE PROTOCOL: MESIF\n");
+                        break;
+                    
+                default:    printf("COHERENCE PROTOCOL: UNKNOWN, Wrong Argument\n");
+            }
+            if(opts.repl != REPL_LRU)
+            {
+                printf("REPLACEMENT POLICY: %s\n", getReplPolicyName(opts.repl));
+            }
+            printf("TRACE FILE: %s\n", fname);
         }
-        printf("TRACE FILE: %s\n", fname);
         
-        /** File Read Storage Variables */
-        char str[2];
-        unsigned long int procNum;
-        unsigned long int procReqAddr;
-        unsigned char reqRW;
+        tracePipeline *pipe = NULL;
         
-        /** Read File Line By Line Until EOF */
-        while(fscanf(pFile, "%lu %s %lx", &procNum, str, &procReqAddr) != EOF)
+        if(opts.pipelineRing > 0)
         {
-            if(str[0]=='w')
+            /** Pipelined Run, Decoder Thread Feeds the Simulation Through a Ring */
+            pipe = new tracePipeline(opts.pipelineRing);
+            if(!pipe->run(*simController, trace))
             {
-                reqRW = (unsigned char)1;
+                printf("Trace file problem\n");
+                exit(0);
             }
-            else
+        }
+        else if(opts.numShards != 1)
+        {
+            /** Set Sharded Run, Counters of All Shards End Up in simController */
+            if(runSharded(*simController, cache_size, cache_assoc, blk_size, trace, opts.numShards) != 0)
             {
-                reqRW = (unsigned char)0;
+                exit(0);
             }
+        }
+        else
+        {
+            /** Decoded Record Batch */
+            static traceRecord batch[TRACE_BATCH];
+            ulong numRecords;
             
-            /** Call the Coherence Controller Class Object with the processAddress method */
-            simController.processRequest(procNum, reqRW, procReqAddr);
+            /** Decode the Mapped Trace Batch By Batch Until EOF */
+            while((numRecords = trace.nextBatch(batch, TRACE_BATCH)) > 0)
+            {
+                /** Call the Coherence Controller Class Object with the processBatch method */
+                simController->processBatch(batch, numRecords);
+            }
             
-            /** Debug: File Read Print */
-            //printf("%lu %c %lx\n", procNum, str[0], procReqAddr);
+            if(trace.hasError())
+            {
+                if(trace.getFormat() == TRACE_FILE_TEXT)
+                {
+                    printf("Trace file problem: malformed record on line %lu\n", trace.getLineNum());
+                }
+                else
+                {
+                    printf("Trace file problem: truncated or corrupt binary trace\n");
+                }
+                exit(0);
+            }
         }
         
-	fclose(pFile);
+	trace.close();
+        simController->finishIntervals();
 
 	/** Call the Coherence Controller Class Object with the dumpData method */
-        simController.dumpMetrics();
+        if(opts.format == FORMAT_TEXT)
+        {
+            simController->dumpMetrics();
+        }
+        else
+        {
+            sweepConfig config = {cache_size, cache_assoc, blk_size, num_processors, currentProtocol, opts.repl};
+            if(opts.format == FORMAT_CSV)
+            {
+                printCsvHeader(num_processors);
+            }
+            printRecord(opts.format, config, fname, simController);
+        }
+        
+        if(pipe != NULL)
+        {
+            if(opts.format == FORMAT_TEXT)
+            {
+                pipe->dumpStats();
+            }
+            delete pipe;
+        }
+        
+        delete simController;
 }
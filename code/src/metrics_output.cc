@@ -0,0 +1,197 @@
+/**
+ * \file metrics_output.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Machine Readable Metrics Output
+ */
+
+#include "metrics_output.h"
+#include "sweep.h"
+#include <stdio.h>
+#include <string.h>
+
+bool parseOutputFormat(const char *name, enum outputFormat &format)
+{
+    if(strcmp(name, "text") == 0)
+    {
+        format = FORMAT_TEXT;
+    }
+    else if(strcmp(name, "json") == 0)
+    {
+        format = FORMAT_JSON;
+    }
+    else if(strcmp(name, "csv") == 0)
+    {
+        format = FORMAT_CSV;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Print a String as a Quoted JSON or CSV Field
+ * \param[in] text String to Print
+ * \param[in] format FORMAT_JSON or FORMAT_CSV
+ */
+static void printQuoted(const char *text, enum outputFormat format)
+{
+    putchar('"');
+    for(; *text != '\0'; text++)
+    {
+        unsigned char c = (unsigned char)*text;
+
+        if(format == FORMAT_CSV)
+        {
+            /** CSV Doubles Embedded Quotes */
+            if(c == '"')
+            {
+                putchar('"');
+            }
+            putchar(c);
+        }
+        else if((c == '"') || (c == '\\'))
+        {
+            printf("\\%c", c);
+        }
+        else if(c < 0x20)
+        {
+            printf("\\u%04x", c);
+        }
+        else
+        {
+            putchar(c);
+        }
+    }
+    putchar('"');
+}
+
+/**
+ * \brief Miss Rate in Percent
+ * \param[in] counters Counter Values, Indexed by cacheCounter
+ * \return Misses per Access in Percent, 0 Without Accesses
+ */
+static double missRate(const ulong *counters)
+{
+    ulong accesses = counters[CNT_READS] + counters[CNT_WRITES];
+
+    return accesses ? (double)(counters[CNT_READ_MISSES] + counters[CNT_WRITE_MISSES])*100.0/accesses : 0.0;
+}
+
+/**
+ * \brief Print a Counter Set as JSON Object Members
+ * \param[in] counters Counter Values, Indexed by cacheCounter
+ */
+static void printJsonCounters(const ulong *counters)
+{
+    int loop_c;
+
+    for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+    {
+        printf("\"%s\":%lu,", getCounterName((enum cacheCounter)loop_c), counters[loop_c]);
+    }
+    printf("\"miss_rate\":%.4f", missRate(counters));
+}
+
+/**
+ * \brief Print a Counter Set as CSV Fields, Each Preceded by a Comma
+ * \param[in] counters Counter Values, Indexed by cacheCounter
+ */
+static void printCsvCounters(const ulong *counters)
+{
+    int loop_c;
+
+    for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+    {
+        printf(",%lu", counters[loop_c]);
+    }
+    printf(",%.4f", missRate(counters));
+}
+
+/**
+ * \brief Print the CSV Column Names of a Counter Set, Each Preceded by a Comma
+ * \param[in] prefix Column Name Prefix
+ */
+static void printCsvCounterNames(const char *prefix)
+{
+    int loop_c;
+
+    for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+    {
+        printf(",%s_%s", prefix, getCounterName((enum cacheCounter)loop_c));
+    }
+    printf(",%s_miss_rate", prefix);
+}
+
+void printCsvHeader(int numProcessors)
+{
+    char prefix[32];
+    int loop_i;
+
+    printf("cache_size,assoc,block_size,processors,protocol,replacement,trace");
+    for(loop_i=0; loop_i<numProcessors; loop_i++)
+    {
+        snprintf(prefix, sizeof(prefix), "cache%d", loop_i);
+        printCsvCounterNames(prefix);
+    }
+    printCsvCounterNames("total");
+    printf("\n");
+}
+
+void printRecord(enum outputFormat format, const sweepConfig &config, const char *traceName, coherenceController *ctrl)
+{
+    ulong counters[NUM_CACHE_COUNTERS];
+    ulong totals[NUM_CACHE_COUNTERS];
+    int loop_i, loop_c;
+
+    memset(totals, 0, sizeof(totals));
+
+    if(format == FORMAT_JSON)
+    {
+        printf("{\"config\":{\"cache_size\":%d,\"assoc\":%d,\"block_size\":%d,\"processors\":%d,\"protocol\":\"%s\",\"replacement\":\"%s\",\"trace\":",
+               config.cacheSize, config.assoc, config.blkSize, config.numProcessors, getProtocolName(config.protocol), getReplPolicyName(config.repl));
+        printQuoted(traceName, format);
+        printf("},\"caches\":[");
+    }
+    else
+    {
+        printf("%d,%d,%d,%d,%s,%s,", config.cacheSize, config.assoc, config.blkSize, config.numProcessors, getProtocolName(config.protocol), getReplPolicyName(config.repl));
+        printQuoted(traceName, format);
+    }
+
+    for(loop_i=0; loop_i<ctrl->getNumProcessors(); loop_i++)
+    {
+        Cache *cache = ctrl->getCache(loop_i);
+        for(loop_c=0; loop_c<NUM_CACHE_COUNTERS; loop_c++)
+        {
+            counters[loop_c] = cache->getCounter((enum cacheCounter)loop_c);
+            totals[loop_c] += counters[loop_c];
+        }
+
+        if(format == FORMAT_JSON)
+        {
+            printf("%s{\"cache\":%d,", loop_i ? "," : "", loop_i);
+            printJsonCounters(counters);
+            printf("}");
+        }
+        else
+        {
+            printCsvCounters(counters);
+        }
+    }
+
+    if(format == FORMAT_JSON)
+    {
+        printf("],\"system\":{");
+        printJsonCounters(totals);
+        printf("}}\n");
+    }
+    else
+    {
+        printCsvCounters(totals);
+        printf("\n");
+    }
+}
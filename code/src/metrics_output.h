@@ -0,0 +1,54 @@
+/**
+ * \file metrics_output.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Machine Readable Metrics Output
+ */
+
+#ifndef __METRICS_OUTPUT_H__
+#define __METRICS_OUTPUT_H__
+
+#include "coherence_ctrl.h"
+
+struct sweepConfig;
+
+/** Metrics Output Format Enumeration */
+enum outputFormat   {
+                        FORMAT_TEXT =   0,  /**< Human Readable Report, the Validated Format */
+                        FORMAT_JSON =   1,  /**< One JSON Object per Run, One per Line */
+                        FORMAT_CSV =    2   /**< One CSV Row per Run, After a Header Row */
+};
+
+/**
+ * \brief Parse an Output Format Name
+ * \param[in] name "text", "json" or "csv"
+ * \param[out] format Parsed Format
+ * \return Whether the Name is Known
+ */
+bool parseOutputFormat(const char *name, enum outputFormat &format);
+
+/**
+ * \brief Print the CSV Header Row Matching printRecord's Rows
+ *
+ * Every counter appears once per cache as cache<i>_<counter> and once
+ * summed over all caches as total_<counter>, so the columns depend on the
+ * processor count.
+ *
+ * \param[in] numProcessors Number of Processors of the Runs that Follow
+ */
+void printCsvHeader(int numProcessors);
+
+/**
+ * \brief Print One Run as a Single Record
+ *
+ * The record holds the configuration, every counter of every cache with
+ * its miss rate, and the same counters summed over all caches.
+ *
+ * \param[in] format FORMAT_JSON or FORMAT_CSV
+ * \param[in] config Configuration that was Simulated
+ * \param[in] traceName Trace File Name
+ * \param[in] ctrl Coherence Controller that Simulated it
+ */
+void printRecord(enum outputFormat format, const sweepConfig &config, const char *traceName, coherenceController *ctrl);
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * \file pipeline.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Pipelined Trace Decode and Coherence Processing
+ */
+
+#include "pipeline.h"
+#include <stdio.h>
+#include <sys/time.h>
+
+using namespace std;
+
+tracePipeline::tracePipeline(ulong ringRecords) : ring(ringRecords)
+{
+    numRecords = 0;
+    seconds = 0.0;
+    error = false;
+}
+
+void tracePipeline::decoder(tracePipeline *pipe, traceReader *trace)
+{
+    static traceRecord batch[TRACE_BATCH];
+    ulong n;
+
+    while((n = trace->nextBatch(batch, TRACE_BATCH)) > 0)
+    {
+        pipe->ring.pushAll(batch, n);
+    }
+    pipe->error = trace->hasError();
+
+    /** Release Orders the error Flag Before the Consumer Sees the Ring Closed */
+    pipe->ring.close();
+}
+
+bool tracePipeline::run(coherenceController &ctrl, traceReader &trace)
+{
+    static traceRecord batch[TRACE_BATCH];
+    struct timeval start, stop;
+    ulong n;
+
+    gettimeofday(&start, NULL);
+
+    thread producer(decoder, this, &trace);
+
+    while((n = ring.popWait(batch, TRACE_BATCH)) > 0)
+    {
+        ctrl.processBatch(batch, n);
+        numRecords += n;
+    }
+
+    producer.join();
+
+    gettimeofday(&stop, NULL);
+    seconds = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_usec - start.tv_usec)*1e-6;
+
+    return !error;
+}
+
+void tracePipeline::dumpStats()
+{
+    printf("============ Pipeline statistics ============\n");
+    printf("ring capacity (records):        \t%lu\n", ring.getCapacity());
+    printf("records simulated:              \t%lu\n", numRecords);
+    printf("records/sec:                    \t%.0f\n", (seconds > 0.0) ? (double)numRecords/seconds : 0.0);
+    printf("decoder stalls (ring full):     \t%lu\n", ring.getProducerStalls());
+    printf("decoder wait yields:            \t%lu\n", ring.getProducerWaits());
+    printf("simulator stalls (ring empty):  \t%lu\n", ring.getConsumerStalls());
+    printf("simulator wait yields:          \t%lu\n", ring.getConsumerWaits());
+}
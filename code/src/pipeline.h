@@ -0,0 +1,63 @@
+/**
+ * \file pipeline.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Pipelined Trace Decode and Coherence Processing
+ */
+
+#ifndef __PIPELINE_H__
+#define __PIPELINE_H__
+
+#include "coherence_ctrl.h"
+#include "trace_reader.h"
+#include "spsc_ring.h"
+
+/** Default Ring Capacity in Records */
+#define PIPELINE_RING_RECORDS 65536
+
+/**
+ * \class tracePipeline
+ * \brief Class Overlapping Trace Decode with Simulation
+ *
+ * A decoder thread fills a single producer single consumer ring with
+ * decoded records while the calling thread drains it in batches into the
+ * coherence controller.
+ */
+class tracePipeline
+{
+protected:
+    spscRing<traceRecord> ring;     /**< Decoded Records in Flight */
+    ulong numRecords;               /**< Records Passed Through the Ring */
+    double seconds;                 /**< Wall Clock Time of the Run */
+    bool error;                     /**< Decoder Stopped on a Malformed Trace */
+
+    /**
+     * \brief Decoder Thread, Decodes the Whole Trace into the Ring
+     * \param[in] pipe Pipeline Being Run
+     * \param[in] trace Opened Trace
+     */
+    static void decoder(tracePipeline *pipe, traceReader *trace);
+
+public:
+
+    /**
+     * \brief tracePipeline Class Constructor
+     * \param[in] ringRecords Ring Capacity in Records
+     */
+    tracePipeline(ulong ringRecords);
+
+    /**
+     * \brief Simulate a Whole Trace
+     * \param[in,out] ctrl Coherence Controller Fed from the Ring
+     * \param[in] trace Opened Trace
+     * \return Whether the Trace Decoded Without Error
+     */
+    bool run(coherenceController &ctrl, traceReader &trace);
+
+    /**
+     * \brief Print Ring Stall Statistics
+     */
+    void dumpStats();
+};
+
+#endif
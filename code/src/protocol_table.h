@@ -0,0 +1,426 @@
+/**
+ * \file protocol_table.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Table Driven Coherence Protocol Definitions
+ *
+ * A protocol is a protocolTable built at compile time. The coherence
+ * controller runs every protocol through the same engine, which only
+ * indexes the tables:
+ *  - proc[state][op]: bus command the requesting cache issues, its counter
+ *    events, and its next state without and with copies in other caches.
+ *  - snoop[command][state]: next state and counter events of a cache that
+ *    holds the block when command is on the bus, and its snoop signal: it
+ *    reports a copy, and may also supply the data.
+ *  - bus[command]: counter events of the requesting cache before the snoop
+ *    and after it, depending on whether a cache or memory supplied the data,
+ *    and whether the command carries an update word.
+ *  - evict[state]: counter events of evicting a block in that state.
+ * A protocol table is under 1 KB, so it stays resident in L1.
+ */
+
+#ifndef __PROTOCOL_TABLE_H__
+#define __PROTOCOL_TABLE_H__
+
+#include "cache.h"
+
+/** Type define unsigned short as ushort */
+typedef unsigned short ushort;
+
+/** Coherence Bus State Enumeration */
+enum bus_state  {
+                    INVALID_BUS =   0,  /**< Bus Inactive - Used In All Protocols */
+                    VALID_BUS =     1,  /**< Bus Active - Used In All Protocols */
+                    BUSRD =         2,  /**< Bus Read Command - Used In All Protocols */
+                    BUSRDX =        3,  /**< Bus Read Exclusive (Write) Command - Used In MSI & MESI Protocols */
+                    FLUSH =         4,  /**< Flush Command - Used In All Protocols */
+                    BUSUPGR =       5,  /**< Bus Upgrade Command - Used In MESI Protocol */
+                    FLUSHOPT =      6,  /**< Flush Optimized - Used In MESI Protocol */
+                    BUSUPD =        7,  /**< Bus Update Command - Used In Dragon Protocol */
+                    CEX =           8,  /**< Copies Exist Signal - Used In MESI & Dragon Protocols */
+                    NCEX =          9,  /**< Copies Do Not Exist Signal - Used In MESI & Dragon Protocols */
+                    BUSRD_UPD =     10  /**< Bus Read Followed by Bus Update, a Write Miss - Used In Dragon Protocol */
+};
+
+/** Number of Bus States */
+#define NUM_BUS_STATES 11
+
+/** Processor Operation Enumeration, the rdWr of a Trace Record */
+enum procOp     {
+                    PROC_RD =   0,  /**< Processor Read */
+                    PROC_WR =   1   /**< Processor Write */
+};
+
+/** Snoop Signal: the Cache Holds a Copy of the Block */
+#define SNOOP_COPY 1
+
+/** Snoop Signal: the Cache Supplies the Block, Implies SNOOP_COPY */
+#define SNOOP_SUPPLY 3
+
+/**
+ * \struct procTransition
+ * \brief Requesting Cache Transition for a (State, Processor Operation) Pair
+ */
+struct procTransition
+{
+    uchar busCommand;               /**< bus_state Placed on the Bus, INVALID_BUS for None */
+    uchar next[2];                  /**< Next cacheFlag, Indexed by Whether Copies Exist Elsewhere */
+    ushort events;                  /**< Counter Events of the Requesting Cache */
+};
+
+/**
+ * \struct snoopTransition
+ * \brief Snooping Cache Transition for a (Bus Command, State) Pair
+ */
+struct snoopTransition
+{
+    uchar next;                     /**< Next cacheFlag, INVALID Invalidates the Line */
+    uchar signal;                   /**< OR of SNOOP_COPY and SNOOP_SUPPLY, 0 for None */
+    ushort events;                  /**< Counter Events of the Snooping Cache */
+};
+
+/**
+ * \struct busActions
+ * \brief Requesting Cache Counter Events of a Bus Command
+ */
+struct busActions
+{
+    ushort before;                  /**< Events When the Command is Placed on the Bus */
+    ushort memory;                  /**< Events After a Snoop that Found No Supplier */
+    ushort cache;                   /**< Events After a Snoop that Found a Supplier */
+    ushort word;                    /**< Whether the Command Carries an Update Word */
+};
+
+/**
+ * \struct protocolTable
+ * \brief Every Transition of a Coherence Protocol
+ */
+struct protocolTable
+{
+    procTransition proc[NUM_CACHE_FLAGS][2];                /**< Requester Transitions, [state][procOp] */
+    snoopTransition snoop[NUM_BUS_STATES][NUM_CACHE_FLAGS]; /**< Snooper Transitions, [bus_state][state] */
+    busActions bus[NUM_BUS_STATES];                         /**< Requester Bus Events, [bus_state] */
+    ushort evict[NUM_CACHE_FLAGS];                          /**< Victim Events, [state] */
+};
+
+/**
+ * \brief Table of a Protocol that Does Nothing
+ *
+ * Reads and writes only count accesses and keep the state; snooping caches
+ * keep their state and report a copy, but do not supply it, when they hold
+ * the block.
+ *
+ * \return Table to Fill In
+ */
+constexpr protocolTable makeIdleTable()
+{
+    protocolTable t = {};
+    int loop_s = 0, loop_c = 0;
+
+    for(loop_s=0; loop_s<NUM_CACHE_FLAGS; loop_s++)
+    {
+        t.proc[loop_s][PROC_RD] = {INVALID_BUS, {(uchar)loop_s, (uchar)loop_s}, EVENT(CNT_READS)};
+        t.proc[loop_s][PROC_WR] = {INVALID_BUS, {(uchar)loop_s, (uchar)loop_s}, EVENT(CNT_WRITES)};
+
+        for(loop_c=0; loop_c<NUM_BUS_STATES; loop_c++)
+        {
+            t.snoop[loop_c][loop_s] = {(uchar)loop_s, (uchar)((loop_s != INVALID) ? SNOOP_COPY : 0), 0};
+        }
+    }
+
+    return t;
+}
+
+/**
+ * \brief Set a Requester Transition, the Access Itself is Always Counted
+ * \param[in,out] t Table
+ * \param[in] state Current State
+ * \param[in] op Processor Operation
+ * \param[in] command Bus Command Issued, INVALID_BUS for None
+ * \param[in] noCopies Next State if No Other Cache Reports a Copy
+ * \param[in] copies Next State if Another Cache Reports a Copy
+ * \param[in] events Counter Events Besides the Access
+ */
+constexpr void setProc(protocolTable &t, enum cacheFlag state, enum procOp op, enum bus_state command, enum cacheFlag noCopies, enum cacheFlag copies, uint events)
+{
+    t.proc[state][op].busCommand = (uchar)command;
+    t.proc[state][op].next[0] = (uchar)noCopies;
+    t.proc[state][op].next[1] = (uchar)copies;
+    t.proc[state][op].events = (ushort)(EVENT((op == PROC_RD) ? CNT_READS : CNT_WRITES) | events);
+}
+
+/**
+ * \brief Set a Snooper Transition
+ * \param[in,out] t Table
+ * \param[in] command Bus Command Snooped
+ * \param[in] state Current State of the Snooping Cache
+ * \param[in] next Next State
+ * \param[in] events Counter Events of the Snooping Cache
+ */
+constexpr void setSnoop(protocolTable &t, enum bus_state command, enum cacheFlag state, enum cacheFlag next, uint events)
+{
+    t.snoop[command][state].next = (uchar)next;
+    t.snoop[command][state].events = (ushort)events;
+}
+
+/**
+ * \brief Set the Requester Events of a Bus Command
+ * \param[in,out] t Table
+ * \param[in] command Bus Command
+ * \param[in] before Events When the Command is Placed on the Bus
+ * \param[in] memory Events After a Snoop that Found No Supplier
+ * \param[in] cache Events After a Snoop that Found a Supplier
+ */
+constexpr void setBus(protocolTable &t, enum bus_state command, uint before, uint memory, uint cache)
+{
+    t.bus[command].before = (ushort)before;
+    t.bus[command].memory = (ushort)memory;
+    t.bus[command].cache = (ushort)cache;
+}
+
+/**
+ * \brief Make a Bus Command Carry an Update Word
+ * \param[in,out] t Table
+ * \param[in] command Bus Command
+ */
+constexpr void setBusWord(protocolTable &t, enum bus_state command)
+{
+    t.bus[command].word = 1;
+}
+
+/**
+ * \brief Make a State Supply the Block to Every Bus Command it Snoops
+ * \param[in,out] t Table
+ * \param[in] state State Holding Data Another Cache May Take
+ */
+constexpr void setSupplier(protocolTable &t, enum cacheFlag state)
+{
+    int loop_c = 0;
+
+    for(loop_c=0; loop_c<NUM_BUS_STATES; loop_c++)
+    {
+        t.snoop[loop_c][state].signal = SNOOP_SUPPLY;
+    }
+}
+
+/** A Dirty Block Written Back to Memory */
+#define EV_WRITEBACK (EVENT(CNT_WRITEBACKS) | EVENT(CNT_MEM_TRANSACTIONS))
+
+/** A Dirty Block Flushed on the Bus and Written Back to Memory */
+#define EV_FLUSH_WRITEBACK (EVENT(CNT_FLUSHES) | EV_WRITEBACK)
+
+/**
+ * \brief MSI Protocol Table
+ * \return Table
+ */
+constexpr protocolTable makeMSITable()
+{
+    protocolTable t = makeIdleTable();
+
+    setProc(t, INVALID, PROC_RD, BUSRD, SHARED, SHARED, EVENT(CNT_READ_MISSES) | EVENT(CNT_BUSRD));
+    setProc(t, INVALID, PROC_WR, BUSRDX, MODIFIED, MODIFIED, EVENT(CNT_WRITE_MISSES) | EVENT(CNT_BUSRDX));
+    setProc(t, SHARED, PROC_WR, BUSRDX, MODIFIED, MODIFIED, EVENT(CNT_BUSRDX));
+
+    setBus(t, BUSRD, EVENT(CNT_MEM_TRANSACTIONS), 0, 0);
+    setSnoop(t, BUSRD, MODIFIED, SHARED, EVENT(CNT_INTERVENTIONS) | EV_FLUSH_WRITEBACK);
+
+    setBus(t, BUSRDX, EVENT(CNT_MEM_TRANSACTIONS), 0, 0);
+    setSnoop(t, BUSRDX, SHARED, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, MODIFIED, INVALID, EVENT(CNT_INVALIDATIONS) | EV_FLUSH_WRITEBACK);
+
+    t.evict[MODIFIED] = EV_WRITEBACK;
+
+    return t;
+}
+
+/**
+ * \brief MESI Protocol Table
+ *
+ * Any cache holding the block supplies it, so a miss that finds a copy is
+ * a cache to cache transfer and one that finds none goes to memory.
+ *
+ * \return Table
+ */
+constexpr protocolTable makeMESITable()
+{
+    protocolTable t = makeIdleTable();
+
+    setSupplier(t, SHARED);
+    setSupplier(t, EXCLUSIVE);
+    setSupplier(t, MODIFIED);
+
+    setProc(t, INVALID, PROC_RD, BUSRD, EXCLUSIVE, SHARED, EVENT(CNT_READ_MISSES) | EVENT(CNT_BUSRD));
+    setProc(t, INVALID, PROC_WR, BUSRDX, MODIFIED, MODIFIED, EVENT(CNT_WRITE_MISSES) | EVENT(CNT_BUSRDX));
+    setProc(t, SHARED, PROC_WR, BUSUPGR, MODIFIED, MODIFIED, EVENT(CNT_BUSUPD_UPGR));
+    setProc(t, EXCLUSIVE, PROC_WR, INVALID_BUS, MODIFIED, MODIFIED, 0);
+
+    setBus(t, BUSRD, 0, EVENT(CNT_MEM_TRANSACTIONS), EVENT(CNT_CACHE2CACHE));
+    setSnoop(t, BUSRD, SHARED, SHARED, 0);
+    setSnoop(t, BUSRD, EXCLUSIVE, SHARED, EVENT(CNT_INTERVENTIONS));
+    setSnoop(t, BUSRD, MODIFIED, SHARED, EVENT(CNT_INTERVENTIONS) | EV_FLUSH_WRITEBACK);
+
+    setBus(t, BUSRDX, 0, EVENT(CNT_MEM_TRANSACTIONS), EVENT(CNT_CACHE2CACHE));
+    setSnoop(t, BUSRDX, SHARED, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, EXCLUSIVE, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, MODIFIED, INVALID, EVENT(CNT_INVALIDATIONS) | EV_FLUSH_WRITEBACK);
+
+    setSnoop(t, BUSUPGR, SHARED, INVALID, EVENT(CNT_INVALIDATIONS));
+
+    t.evict[MODIFIED] = EV_WRITEBACK;
+
+    return t;
+}
+
+/**
+ * \brief Dragon Protocol Table
+ *
+ * A write miss is a BusRd followed by a BusUpd, kept as its own command
+ * because it reads memory and a shared modified owner flushes, which a
+ * BusUpd from a write hit does not.
+ *
+ * \return Table
+ */
+constexpr protocolTable makeDragonTable()
+{
+    protocolTable t = makeIdleTable();
+
+    setProc(t, INVALID, PROC_RD, BUSRD, EXCLUSIVE, SCLEAN, EVENT(CNT_READ_MISSES) | EVENT(CNT_BUSRD));
+    setProc(t, INVALID, PROC_WR, BUSRD_UPD, MODIFIED, SMODIFIED, EVENT(CNT_WRITE_MISSES) | EVENT(CNT_BUSRD) | EVENT(CNT_BUSUPD_UPGR));
+    setProc(t, EXCLUSIVE, PROC_WR, INVALID_BUS, MODIFIED, MODIFIED, 0);
+    setProc(t, SCLEAN, PROC_WR, BUSUPD, MODIFIED, SMODIFIED, EVENT(CNT_BUSUPD_UPGR));
+    setProc(t, SMODIFIED, PROC_WR, BUSUPD, MODIFIED, SMODIFIED, EVENT(CNT_BUSUPD_UPGR));
+
+    setBus(t, BUSRD, EVENT(CNT_MEM_TRANSACTIONS), 0, 0);
+    setSnoop(t, BUSRD, EXCLUSIVE, SCLEAN, EVENT(CNT_INTERVENTIONS));
+    setSnoop(t, BUSRD, MODIFIED, SMODIFIED, EVENT(CNT_INTERVENTIONS) | EVENT(CNT_FLUSHES));
+    setSnoop(t, BUSRD, SMODIFIED, SMODIFIED, EVENT(CNT_FLUSHES));
+
+    setBusWord(t, BUSUPD);
+    setSnoop(t, BUSUPD, EXCLUSIVE, SCLEAN, EVENT(CNT_INTERVENTIONS));
+    setSnoop(t, BUSUPD, MODIFIED, SCLEAN, EVENT(CNT_INTERVENTIONS) | EVENT(CNT_FLUSHES));
+    setSnoop(t, BUSUPD, SMODIFIED, SCLEAN, 0);
+
+    setBus(t, BUSRD_UPD, EVENT(CNT_MEM_TRANSACTIONS), 0, 0);
+    setBusWord(t, BUSRD_UPD);
+    setSnoop(t, BUSRD_UPD, EXCLUSIVE, SCLEAN, EVENT(CNT_INTERVENTIONS));
+    setSnoop(t, BUSRD_UPD, MODIFIED, SCLEAN, EVENT(CNT_INTERVENTIONS) | EVENT(CNT_FLUSHES));
+    setSnoop(t, BUSRD_UPD, SMODIFIED, SCLEAN, EVENT(CNT_FLUSHES));
+
+    t.evict[MODIFIED] = EV_WRITEBACK;
+    t.evict[SMODIFIED] = EV_WRITEBACK;
+
+    return t;
+}
+
+/**
+ * \brief MOESI Protocol Table
+ *
+ * MESI with an Owned state. A modified block that another cache reads
+ * becomes Owned and keeps supplying the dirty data, instead of being
+ * written back; only evicting M or O writes back. Any cache holding the
+ * block supplies it, as in MESI.
+ *
+ * \return Table
+ */
+constexpr protocolTable makeMOESITable()
+{
+    protocolTable t = makeIdleTable();
+
+    setSupplier(t, SHARED);
+    setSupplier(t, EXCLUSIVE);
+    setSupplier(t, OWNED);
+    setSupplier(t, MODIFIED);
+
+    setProc(t, INVALID, PROC_RD, BUSRD, EXCLUSIVE, SHARED, EVENT(CNT_READ_MISSES) | EVENT(CNT_BUSRD));
+    setProc(t, INVALID, PROC_WR, BUSRDX, MODIFIED, MODIFIED, EVENT(CNT_WRITE_MISSES) | EVENT(CNT_BUSRDX));
+    setProc(t, SHARED, PROC_WR, BUSUPGR, MODIFIED, MODIFIED, EVENT(CNT_BUSUPD_UPGR));
+    setProc(t, OWNED, PROC_WR, BUSUPGR, MODIFIED, MODIFIED, EVENT(CNT_BUSUPD_UPGR));
+    setProc(t, EXCLUSIVE, PROC_WR, INVALID_BUS, MODIFIED, MODIFIED, 0);
+
+    setBus(t, BUSRD, 0, EVENT(CNT_MEM_TRANSACTIONS), EVENT(CNT_CACHE2CACHE));
+    setSnoop(t, BUSRD, SHARED, SHARED, 0);
+    setSnoop(t, BUSRD, EXCLUSIVE, SHARED, EVENT(CNT_INTERVENTIONS));
+    setSnoop(t, BUSRD, OWNED, OWNED, EVENT(CNT_FLUSHES));
+    setSnoop(t, BUSRD, MODIFIED, OWNED, EVENT(CNT_INTERVENTIONS) | EVENT(CNT_FLUSHES));
+
+    setBus(t, BUSRDX, 0, EVENT(CNT_MEM_TRANSACTIONS), EVENT(CNT_CACHE2CACHE));
+    setSnoop(t, BUSRDX, SHARED, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, EXCLUSIVE, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, OWNED, INVALID, EVENT(CNT_INVALIDATIONS) | EVENT(CNT_FLUSHES));
+    setSnoop(t, BUSRDX, MODIFIED, INVALID, EVENT(CNT_INVALIDATIONS) | EVENT(CNT_FLUSHES));
+
+    /** The Upgrading Cache Takes Over the Dirty Data of an Owner */
+    setSnoop(t, BUSUPGR, SHARED, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSUPGR, OWNED, INVALID, EVENT(CNT_INVALIDATIONS));
+
+    t.evict[MODIFIED] = EV_WRITEBACK;
+    t.evict[OWNED] = EV_WRITEBACK;
+
+    return t;
+}
+
+/**
+ * \brief MESIF Protocol Table
+ *
+ * MESI where only one clean copy, the Forward one, supplies the block. The
+ * newest reader takes the Forward state. When only Shared copies are left,
+ * a miss reads memory even though copies exist.
+ *
+ * \return Table
+ */
+constexpr protocolTable makeMESIFTable()
+{
+    protocolTable t = makeIdleTable();
+
+    setSupplier(t, FORWARD);
+    setSupplier(t, EXCLUSIVE);
+    setSupplier(t, MODIFIED);
+
+    setProc(t, INVALID, PROC_RD, BUSRD, EXCLUSIVE, FORWARD, EVENT(CNT_READ_MISSES) | EVENT(CNT_BUSRD));
+    setProc(t, INVALID, PROC_WR, BUSRDX, MODIFIED, MODIFIED, EVENT(CNT_WRITE_MISSES) | EVENT(CNT_BUSRDX));
+    setProc(t, SHARED, PROC_WR, BUSUPGR, MODIFIED, MODIFIED, EVENT(CNT_BUSUPD_UPGR));
+    setProc(t, FORWARD, PROC_WR, BUSUPGR, MODIFIED, MODIFIED, EVENT(CNT_BUSUPD_UPGR));
+    setProc(t, EXCLUSIVE, PROC_WR, INVALID_BUS, MODIFIED, MODIFIED, 0);
+
+    setBus(t, BUSRD, 0, EVENT(CNT_MEM_TRANSACTIONS), EVENT(CNT_CACHE2CACHE));
+    setSnoop(t, BUSRD, SHARED, SHARED, 0);
+    setSnoop(t, BUSRD, FORWARD, SHARED, 0);
+    setSnoop(t, BUSRD, EXCLUSIVE, SHARED, EVENT(CNT_INTERVENTIONS));
+    setSnoop(t, BUSRD, MODIFIED, SHARED, EVENT(CNT_INTERVENTIONS) | EV_FLUSH_WRITEBACK);
+
+    setBus(t, BUSRDX, 0, EVENT(CNT_MEM_TRANSACTIONS), EVENT(CNT_CACHE2CACHE));
+    setSnoop(t, BUSRDX, SHARED, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, FORWARD, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, EXCLUSIVE, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSRDX, MODIFIED, INVALID, EVENT(CNT_INVALIDATIONS) | EV_FLUSH_WRITEBACK);
+
+    setSnoop(t, BUSUPGR, SHARED, INVALID, EVENT(CNT_INVALIDATIONS));
+    setSnoop(t, BUSUPGR, FORWARD, INVALID, EVENT(CNT_INVALIDATIONS));
+
+    t.evict[MODIFIED] = EV_WRITEBACK;
+
+    return t;
+}
+
+/**
+ * \brief Check Whether a Bus Command Invalidates the Copies it Snoops
+ * \param[in] t Table
+ * \param[in] command Bus Command
+ * \return Whether Any Valid State Snooping the Command Goes Invalid
+ */
+constexpr bool invalidatesCopies(const protocolTable &t, uchar command)
+{
+    int loop_s = 0;
+
+    for(loop_s=0; loop_s<NUM_CACHE_FLAGS; loop_s++)
+    {
+        if((loop_s != INVALID) && (t.snoop[command][loop_s].next == INVALID))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#endif
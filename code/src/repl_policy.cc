@@ -0,0 +1,421 @@
+/**
+ * \file repl_policy.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Cache Replacement Policies
+ */
+
+#include "repl_policy.h"
+#include "zero_pages.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace std;
+
+/** Largest Re-Reference Prediction Value of the 2 Bit RRIP Policies */
+#define RRPV_MAX 3
+
+/** One in this Many BRRIP Fills is Inserted at RRPV_MAX-1 Instead of RRPV_MAX */
+#define BRRIP_LONG_PERIOD 32
+
+/**
+ * \class lruPolicy
+ * \brief True LRU as a Doubly Linked Recency List per Set
+ *
+ * Touching a way moves it to the head in O(1) and the victim is the tail,
+ * so no timestamps are kept or scanned. Links are way indices of type
+ * wayIndex, the narrowest holding assoc, so a line's replacement state is
+ * two bytes for sets of up to 255 ways.
+ *
+ * The arrays start zero filled and a set's list is only linked the first
+ * time a second way is touched, seen as its head equal to its tail, which
+ * never happens in a linked list of more than one way. Every way is filled,
+ * and so touched, before a victim is asked for, so the initial order of
+ * the list never shows.
+ */
+template <typename wayIndex>
+class lruPolicy : public replPolicy
+{
+protected:
+    zeroArray<wayIndex> prev;   /**< Next More Recent Way, per Line */
+    zeroArray<wayIndex> next;   /**< Next Less Recent Way, per Line */
+    zeroArray<wayIndex> head;   /**< Most Recently Used Way, per Set */
+    zeroArray<wayIndex> tail;   /**< Least Recently Used Way, per Set */
+
+    /**
+     * \brief Link the Ways of a Set in Order, Way 0 Most Recent
+     * \param[in] set Set Index
+     */
+    void linkSet(ulong set)
+    {
+        ulong base = set*assoc;
+        ulong loop_w;
+
+        for(loop_w=0; loop_w<assoc; loop_w++)
+        {
+            prev[base + loop_w] = (wayIndex)(loop_w - 1);
+            next[base + loop_w] = (wayIndex)(loop_w + 1);
+        }
+        head[set] = 0;
+        tail[set] = (wayIndex)(assoc - 1);
+    }
+
+public:
+
+    lruPolicy(ulong s, ulong a) : replPolicy(s, a), prev(s*a), next(s*a), head(s), tail(s)
+    {
+    }
+
+    void touch(ulong set, ulong way)
+    {
+        ulong base = set*assoc;
+        wayIndex w = (wayIndex)way;
+
+        if(head[set] == w)
+        {
+            return;
+        }
+        if(head[set] == tail[set])
+        {
+            linkSet(set);
+        }
+
+        /** Unlink, the Way is Not the Head so it Has a More Recent Neighbour */
+        wayIndex p = prev[base + w];
+        wayIndex n = next[base + w];
+        next[base + p] = n;
+        if(tail[set] == w)
+        {
+            tail[set] = p;
+        }
+        else
+        {
+            prev[base + n] = p;
+        }
+
+        /** Relink as the Head */
+        next[base + w] = head[set];
+        prev[base + head[set]] = w;
+        head[set] = w;
+    }
+
+    void insert(ulong set, ulong way)
+    {
+        touch(set, way);
+    }
+
+    ulong getVictim(ulong set)
+    {
+        return tail[set];
+    }
+};
+
+/**
+ * \class treePlruPolicy
+ * \brief Binary Tree Pseudo LRU, assoc-1 Direction Bits per Set
+ *
+ * Node 1 is the root and node k has children 2k and 2k+1. Each bit points
+ * toward the half of its subtree that was used less recently.
+ */
+class treePlruPolicy : public replPolicy
+{
+protected:
+    zeroArray<uchar> tree;  /**< Direction Bits, Nodes 1 to assoc-1 of Each Set */
+    ulong levels;           /**< Depth of the Tree, log2(assoc) */
+
+public:
+
+    treePlruPolicy(ulong s, ulong a) : replPolicy(s, a), tree(s*a)
+    {
+        levels = 0;
+        while((1UL << levels) < assoc)
+        {
+            levels++;
+        }
+    }
+
+    void touch(ulong set, ulong way)
+    {
+        uchar *bits = &tree[set*assoc];
+        ulong node = 1;
+        ulong loop_l;
+
+        for(loop_l=levels; loop_l>0; loop_l--)
+        {
+            ulong dir = (way >> (loop_l - 1)) & 1;
+            bits[node] = (uchar)(dir ^ 1);
+            node = 2*node + dir;
+        }
+    }
+
+    void insert(ulong set, ulong way)
+    {
+        touch(set, way);
+    }
+
+    ulong getVictim(ulong set)
+    {
+        const uchar *bits = &tree[set*assoc];
+        ulong node = 1, way = 0;
+        ulong loop_l;
+
+        for(loop_l=0; loop_l<levels; loop_l++)
+        {
+            way = (way << 1) | bits[node];
+            node = 2*node + bits[node];
+        }
+
+        return way;
+    }
+};
+
+/**
+ * \class bitPlruPolicy
+ * \brief MRU Bit Pseudo LRU
+ *
+ * Touching a way sets its bit; once every bit of the set is set, all but
+ * the touched one are cleared. The victim is the lowest way whose bit is
+ * clear.
+ */
+class bitPlruPolicy : public replPolicy
+{
+protected:
+    ulong words;            /**< 64 Bit Words per Set */
+    zeroArray<ulong> mru;   /**< MRU Bits, words Words per Set */
+
+public:
+
+    bitPlruPolicy(ulong s, ulong a) : replPolicy(s, a), words((a + 63)/64), mru(s*words)
+    {
+    }
+
+    /**
+     * \brief Get the Mask of the Ways Held in One Word of a Set
+     * \param[in] word Word Index within the Set
+     * \return Bits of the Ways that Exist
+     */
+    ulong wayMask(ulong word)
+    {
+        ulong ways = assoc - word*64;
+        return (ways >= 64) ? ~0UL : ((1UL << ways) - 1);
+    }
+
+    void touch(ulong set, ulong way)
+    {
+        ulong *bits = &mru[set*words];
+        ulong loop_w;
+
+        bits[way/64] |= 1UL << (way % 64);
+
+        for(loop_w=0; loop_w<words; loop_w++)
+        {
+            if(bits[loop_w] != wayMask(loop_w))
+            {
+                return;
+            }
+        }
+
+        memset(bits, 0, words*sizeof(ulong));
+        bits[way/64] = 1UL << (way % 64);
+    }
+
+    void insert(ulong set, ulong way)
+    {
+        touch(set, way);
+    }
+
+    ulong getVictim(ulong set)
+    {
+        const ulong *bits = &mru[set*words];
+        ulong loop_w;
+
+        /** Only a Direct Mapped Set Keeps All its Bits Set */
+        for(loop_w=0; loop_w<words; loop_w++)
+        {
+            ulong clear = ~bits[loop_w] & wayMask(loop_w);
+            if(clear != 0)
+            {
+                return loop_w*64 + __builtin_ctzl(clear);
+            }
+        }
+
+        return 0;
+    }
+};
+
+/**
+ * \class rripPolicy
+ * \brief SRRIP and BRRIP with 2 Bit Re-Reference Prediction Values
+ *
+ * Hits predict a near re-reference (RRPV 0). SRRIP fills at a long
+ * re-reference interval (RRPV_MAX-1); BRRIP fills at a distant one
+ * (RRPV_MAX) except for one fill in BRRIP_LONG_PERIOD per set. The victim
+ * is the first way at RRPV_MAX, after ageing the set until one exists.
+ * Values start at zero: every way is filled, so given a value, before the
+ * set is asked for a victim.
+ */
+class rripPolicy : public replPolicy
+{
+protected:
+    zeroArray<uchar> rrpv;  /**< Re-Reference Prediction Value per Line */
+    zeroArray<uchar> fills; /**< BRRIP Fill Count per Set, Modulo BRRIP_LONG_PERIOD */
+    bool bimodal;           /**< BRRIP Rather than SRRIP */
+
+public:
+
+    rripPolicy(ulong s, ulong a, bool brrip) : replPolicy(s, a), rrpv(s*a), fills(s)
+    {
+        bimodal = brrip;
+    }
+
+    void touch(ulong set, ulong way)
+    {
+        rrpv[set*assoc + way] = 0;
+    }
+
+    void insert(ulong set, ulong way)
+    {
+        uchar value = RRPV_MAX - 1;
+
+        if(bimodal)
+        {
+            fills[set] = (uchar)((fills[set] + 1) % BRRIP_LONG_PERIOD);
+            value = (fills[set] == 0) ? RRPV_MAX - 1 : RRPV_MAX;
+        }
+        rrpv[set*assoc + way] = value;
+    }
+
+    ulong getVictim(ulong set)
+    {
+        uchar *values = &rrpv[set*assoc];
+        ulong loop_w, victim = 0;
+        uchar oldest = 0;
+
+        for(loop_w=0; loop_w<assoc; loop_w++)
+        {
+            if(values[loop_w] > oldest)
+            {
+                oldest = values[loop_w];
+                victim = loop_w;
+            }
+        }
+
+        /** Ageing Until a Way Reaches RRPV_MAX Adds the Same Amount to Every Way */
+        if(oldest < RRPV_MAX)
+        {
+            uchar age = RRPV_MAX - oldest;
+            for(loop_w=0; loop_w<assoc; loop_w++)
+            {
+                values[loop_w] += age;
+            }
+        }
+
+        return victim;
+    }
+};
+
+/**
+ * \class randomPolicy
+ * \brief Uniformly Random Victim from a Per Set xorshift Generator
+ *
+ * A set's generator is seeded on its first victim; xorshift never reaches
+ * zero from a non zero state, so zero marks an unseeded set.
+ */
+class randomPolicy : public replPolicy
+{
+protected:
+    zeroArray<uint> state;  /**< Generator State per Set, Zero Until Seeded */
+
+public:
+
+    randomPolicy(ulong s, ulong a) : replPolicy(s, a), state(s)
+    {
+    }
+
+    void touch(ulong set, ulong way)
+    {
+    }
+
+    void insert(ulong set, ulong way)
+    {
+    }
+
+    ulong getVictim(ulong set)
+    {
+        uint x = state[set];
+        if(x == 0)
+        {
+            x = (uint)(set*2654435761UL) | 1;
+        }
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        state[set] = x;
+
+        return x % assoc;
+    }
+};
+
+/** Policy Names, Indexed by replKind */
+static const char *replNames[] = {"lru", "tree-plru", "bit-plru", "srrip", "brrip", "random"};
+
+bool parseReplPolicy(const char *name, enum replKind &kind)
+{
+    ulong loop_k;
+
+    for(loop_k=0; loop_k<sizeof(replNames)/sizeof(replNames[0]); loop_k++)
+    {
+        if(strcmp(name, replNames[loop_k]) == 0)
+        {
+            kind = (enum replKind)loop_k;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const char *getReplPolicyName(enum replKind kind)
+{
+    if((uint)kind < sizeof(replNames)/sizeof(replNames[0]))
+    {
+        return replNames[kind];
+    }
+
+    return "UNKNOWN";
+}
+
+replPolicy *createReplPolicy(enum replKind kind, ulong sets, ulong assoc)
+{
+    switch(kind)
+    {
+        case REPL_LRU:          if(assoc <= 0xFF)
+                                {
+                                    return new lruPolicy<uchar>(sets, assoc);
+                                }
+                                else if(assoc <= 0xFFFF)
+                                {
+                                    return new lruPolicy<unsigned short>(sets, assoc);
+                                }
+                                return new lruPolicy<uint>(sets, assoc);
+
+        case REPL_TREE_PLRU:    if((assoc & (assoc - 1)) != 0)
+                                {
+                                    printf("REPLACEMENT POLICY: tree-plru needs a power of two associativity\n");
+                                    exit(0);
+                                }
+                                return new treePlruPolicy(sets, assoc);
+
+        case REPL_BIT_PLRU:     return new bitPlruPolicy(sets, assoc);
+
+        case REPL_SRRIP:        return new rripPolicy(sets, assoc, false);
+
+        case REPL_BRRIP:        return new rripPolicy(sets, assoc, true);
+
+        case REPL_RANDOM:       return new randomPolicy(sets, assoc);
+    }
+
+    printf("REPLACEMENT POLICY: UNKNOWN\n");
+    exit(0);
+}
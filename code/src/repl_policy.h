@@ -0,0 +1,110 @@
+/**
+ * \file repl_policy.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Cache Replacement Policies
+ */
+
+#ifndef __REPL_POLICY_H__
+#define __REPL_POLICY_H__
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/** Type define unsigned char as uchar */
+typedef unsigned char uchar;
+
+/** Type define unsigned int as uint */
+typedef unsigned int uint;
+
+/** Replacement Policy Enumeration */
+enum replKind   {
+                    REPL_LRU =          0,  /**< True LRU, Per Set Recency List */
+                    REPL_TREE_PLRU =    1,  /**< Binary Tree Pseudo LRU, Power of Two Associativity */
+                    REPL_BIT_PLRU =     2,  /**< MRU Bit Pseudo LRU */
+                    REPL_SRRIP =        3,  /**< Static Re-Reference Interval Prediction, 2 Bit RRPV */
+                    REPL_BRRIP =        4,  /**< Bimodal Re-Reference Interval Prediction, 2 Bit RRPV */
+                    REPL_RANDOM =       5   /**< Uniformly Random Way */
+};
+
+/**
+ * \class replPolicy
+ * \brief Base Class of the Replacement State of Every Set of a Cache
+ *
+ * The cache fills invalid ways first and asks the policy for a victim only
+ * when every way of the set is valid. All state is per set, so simulating
+ * disjoint groups of sets in separate caches gives the same victims as
+ * simulating them in one.
+ */
+class replPolicy
+{
+protected:
+    ulong sets;         /**< Number of Sets */
+    ulong assoc;        /**< Ways per Set */
+
+public:
+
+    /**
+     * \brief replPolicy Class Constructor
+     * \param[in] s Number of Sets
+     * \param[in] a Ways per Set
+     */
+    replPolicy(ulong s, ulong a)
+    {
+        sets = s; assoc = a;
+    }
+
+    /**
+     * \brief replPolicy Class Destructor
+     */
+    virtual ~replPolicy()
+    {
+    }
+
+    /**
+     * \brief Record a Hit on a Way
+     * \param[in] set Set Index
+     * \param[in] way Way that Hit
+     */
+    virtual void touch(ulong set, ulong way) = 0;
+
+    /**
+     * \brief Record a Block Filled into a Way
+     * \param[in] set Set Index
+     * \param[in] way Way that was Filled
+     */
+    virtual void insert(ulong set, ulong way) = 0;
+
+    /**
+     * \brief Choose the Way to Evict from a Set whose Ways are All Valid
+     * \param[in] set Set Index
+     * \return Victim Way
+     */
+    virtual ulong getVictim(ulong set) = 0;
+};
+
+/**
+ * \brief Look Up a Replacement Policy by Name
+ * \param[in] name Policy Name, as Returned by getReplPolicyName
+ * \param[out] kind Policy Kind
+ * \return Whether the Name is Known
+ */
+bool parseReplPolicy(const char *name, enum replKind &kind);
+
+/**
+ * \brief Get the Printable Name of a Replacement Policy
+ * \param[in] kind Policy Kind
+ * \return Policy Name
+ */
+const char *getReplPolicyName(enum replKind kind);
+
+/**
+ * \brief Create the Replacement State of a Cache
+ * \param[in] kind Policy Kind
+ * \param[in] sets Number of Sets
+ * \param[in] assoc Ways per Set
+ * \return New Policy Object, Owned by the Caller
+ */
+replPolicy *createReplPolicy(enum replKind kind, ulong sets, ulong assoc);
+
+#endif
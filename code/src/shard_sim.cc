@@ -0,0 +1,114 @@
+/**
+ * \file shard_sim.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Set Sharded Parallel Simulation of One Configuration
+ */
+
+#include "shard_sim.h"
+#include "spsc_ring.h"
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/** Records Each Shard's Ring Holds, Bounding the Records Decoded Ahead of the Workers */
+#define SHARD_RING_RECORDS 16384
+
+/**
+ * \brief Shard Worker, Runs One Controller over the Records of its Sets
+ * \param[in] ctrl Controller Owned by the Shard
+ * \param[in] ring Records Routed to the Shard, in Trace Order, Closed by the Dispatcher
+ */
+static void shardWorker(coherenceController *ctrl, spscRing<traceRecord> *ring)
+{
+    vector<traceRecord> batch(TRACE_BATCH);
+    ulong numRecords;
+
+    while((numRecords = ring->popWait(&batch[0], TRACE_BATCH)) > 0)
+    {
+        ctrl->processBatch(&batch[0], numRecords);
+    }
+}
+
+int runSharded(coherenceController &ctrl, int s, int a, int b, traceReader &trace, int numShards)
+{
+    if(numShards <= 0)
+    {
+        numShards = (int)thread::hardware_concurrency();
+    }
+    if(numShards < 1)
+    {
+        numShards = 1;
+    }
+
+    /** Shard 0 Runs on the Caller's Controller, the Rest on Fresh Ones, Every Shard on its Own Thread */
+    vector<coherenceController *> ctrls(numShards, &ctrl);
+    vector<spscRing<traceRecord> *> rings(numShards);
+    vector< vector<traceRecord> > staged(numShards);
+    vector<thread> pool;
+    int loop_s;
+    for(loop_s=0; loop_s<numShards; loop_s++)
+    {
+        if(loop_s > 0)
+        {
+            ctrls[loop_s] = createController(s, a, b, ctrl.getNumProcessors(), ctrl.getProtocol(), ctrl.getReplacement(), ctrl.getLayout());
+            ctrls[loop_s]->setTraffic(ctrl.getTraffic());
+        }
+        rings[loop_s] = new spscRing<traceRecord>(SHARD_RING_RECORDS);
+        staged[loop_s].reserve(TRACE_BATCH);
+        pool.push_back(thread(shardWorker, ctrls[loop_s], rings[loop_s]));
+    }
+
+    /** Dispatch: Route Every Record to the Shard Owning its Set While the Workers Run, Keeping Trace Order */
+    static traceRecord batch[TRACE_BATCH];
+    ulong numRecords, loop_r;
+    uint numProcessors = (uint)ctrl.getNumProcessors();
+    Cache *geometry = ctrl.getCache(0);
+    int status = 0;
+
+    while((status == 0) && ((numRecords = trace.nextBatch(batch, TRACE_BATCH)) > 0))
+    {
+        for(loop_r=0; loop_r<numRecords; loop_r++)
+        {
+            if(batch[loop_r].procNum >= numProcessors)
+            {
+                printf("Trace file problem: processor %u out of range\n", batch[loop_r].procNum);
+                status = 1;
+                break;
+            }
+            staged[geometry->calcIndex(batch[loop_r].addr) % numShards].push_back(batch[loop_r]);
+        }
+        for(loop_s=0; loop_s<numShards; loop_s++)
+        {
+            if(!staged[loop_s].empty())
+            {
+                rings[loop_s]->pushAll(&staged[loop_s][0], staged[loop_s].size());
+                staged[loop_s].clear();
+            }
+        }
+    }
+    if((status == 0) && trace.hasError())
+    {
+        printf("Trace file problem\n");
+        status = 1;
+    }
+
+    for(loop_s=0; loop_s<numShards; loop_s++)
+    {
+        rings[loop_s]->close();
+    }
+    for(loop_s=0; loop_s<numShards; loop_s++)
+    {
+        pool[loop_s].join();
+        delete rings[loop_s];
+        if(loop_s > 0)
+        {
+            ctrl.mergeMetrics(ctrls[loop_s]);
+            delete ctrls[loop_s];
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file shard_sim.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Set Sharded Parallel Simulation of One Configuration
+ *
+ * Every cache on the bus has the same geometry and a request only ever
+ * touches one set index, in the requester and in every snooped cache, so
+ * the sets can be split between workers. Shard k owns every set whose
+ * index is k modulo the shard count and runs the unmodified protocol logic
+ * on its own controller; the per cache counters of all shards are summed
+ * at the end and match a serial run exactly.
+ *
+ * The calling thread decodes the trace and routes each record into its
+ * shard's bounded ring while the workers simulate, so decoding overlaps
+ * simulation and memory stays fixed whatever the trace length.
+ */
+
+#ifndef __SHARD_SIM_H__
+#define __SHARD_SIM_H__
+
+#include "coherence_ctrl.h"
+#include "trace_reader.h"
+
+/**
+ * \brief Simulate a Trace Split by Set Index over Worker Threads
+ * \param[in,out] ctrl Controller of the Configuration, Shard 0's Controller, Receives the Merged Counters
+ * \param[in] s Cache Size ctrl was Built With
+ * \param[in] a Cache Associativity ctrl was Built With
+ * \param[in] b Cache Block Size ctrl was Built With
+ * \param[in] trace Opened Trace
+ * \param[in] numShards Number of Shards (One Worker Thread Each), 0 for One per Hardware Thread
+ * \return 0 on Success, Non Zero if the Trace is Malformed
+ */
+int runSharded(coherenceController &ctrl, int s, int a, int b, traceReader &trace, int numShards);
+
+#endif
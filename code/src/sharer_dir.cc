@@ -0,0 +1,129 @@
+/**
+ * \file sharer_dir.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Simulator Side Sharer Directory
+ */
+
+#include "sharer_dir.h"
+#include <string.h>
+
+/** Initial Number of Slots (log2) */
+#define SHARER_DIR_LOG2_INIT 10
+
+sharerDirectory::sharerDirectory(uint numProcessors)
+{
+    numWords = (numProcessors + SHARER_WORD_BITS - 1)/SHARER_WORD_BITS;
+    if(numWords == 0)
+    {
+        numWords = 1;
+    }
+    log2Capacity = SHARER_DIR_LOG2_INIT;
+    capacity = 1UL << log2Capacity;
+    numEntries = 0;
+
+    keys = new ulong[capacity]();
+    sets = new ulong[capacity*numWords]();
+}
+
+void sharerDirectory::grow()
+{
+    ulong oldCapacity = capacity;
+    ulong *oldKeys = keys;
+    ulong *oldSets = sets;
+    ulong slot, i;
+
+    log2Capacity++;
+    capacity <<= 1;
+    keys = new ulong[capacity]();
+    sets = new ulong[capacity*numWords]();
+
+    for(i=0; i<oldCapacity; i++)
+    {
+        if(oldKeys[i] != 0)
+        {
+            slot = findSlot(oldKeys[i]);
+            keys[slot] = oldKeys[i];
+            memcpy(&sets[slot*numWords], &oldSets[i*numWords], numWords*sizeof(ulong));
+        }
+    }
+
+    delete [] oldKeys;
+    delete [] oldSets;
+}
+
+void sharerDirectory::add(ulong block, uint procNum)
+{
+    ulong key = block + 1;
+    ulong slot = findSlot(key);
+
+    if(keys[slot] == 0)
+    {
+        /** Keep the Load Factor at or Below One Half */
+        if(2*(numEntries + 1) > capacity)
+        {
+            grow();
+            slot = findSlot(key);
+        }
+        keys[slot] = key;
+        numEntries++;
+    }
+
+    sets[slot*numWords + procNum/SHARER_WORD_BITS] |= 1UL << (procNum % SHARER_WORD_BITS);
+}
+
+void sharerDirectory::remove(ulong block, uint procNum)
+{
+    ulong key = block + 1;
+    ulong slot = findSlot(key);
+    ulong mask = capacity - 1;
+    ulong i;
+
+    if(keys[slot] == 0)
+    {
+        return;
+    }
+
+    ulong *set = &sets[slot*numWords];
+    set[procNum/SHARER_WORD_BITS] &= ~(1UL << (procNum % SHARER_WORD_BITS));
+    for(i=0; i<numWords; i++)
+    {
+        if(set[i] != 0)
+        {
+            return;
+        }
+    }
+
+    /** Last Sharer Gone: Backward Shift Deletion Closes the Hole in the Probe Chain */
+    ulong hole = slot;
+    ulong next = (hole + 1) & mask;
+    while(keys[next] != 0)
+    {
+        ulong home = homeSlot(keys[next]);
+        /** Move the Entry Back Unless its Home Lies Cyclically in (hole, next] */
+        if(((next - home) & mask) >= ((next - hole) & mask))
+        {
+            keys[hole] = keys[next];
+            memcpy(&sets[hole*numWords], &sets[next*numWords], numWords*sizeof(ulong));
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    keys[hole] = 0;
+    memset(&sets[hole*numWords], 0, numWords*sizeof(ulong));
+    numEntries--;
+}
+
+void sharerDirectory::getSharers(ulong block, ulong *out)
+{
+    ulong slot = findSlot(block + 1);
+
+    if(keys[slot] == 0)
+    {
+        memset(out, 0, numWords*sizeof(ulong));
+    }
+    else
+    {
+        memcpy(out, &sets[slot*numWords], numWords*sizeof(ulong));
+    }
+}
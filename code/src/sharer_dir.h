@@ -0,0 +1,178 @@
+/**
+ * \file sharer_dir.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Simulator Side Sharer Directory
+ */
+
+#ifndef __SHARER_DIR_H__
+#define __SHARER_DIR_H__
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/** Type define unsigned int as uint */
+typedef unsigned int uint;
+
+/** Bits in One Sharer Set Word */
+#define SHARER_WORD_BITS 64
+
+/**
+ * \class sharerIterator
+ * \brief Class Walking the Processors of a Sharer Set in Ascending Order
+ */
+class sharerIterator
+{
+protected:
+    const ulong *words;     /**< Sharer Set Words */
+    ulong numWords;         /**< Number of Words */
+    ulong word;             /**< Word Being Walked */
+    ulong bits;             /**< Bits of the Current Word Not Yet Returned */
+
+public:
+
+    /**
+     * \brief sharerIterator Class Constructor
+     * \param[in] w Sharer Set Words, Must Not Change While Iterating
+     * \param[in] n Number of Words
+     */
+    sharerIterator(const ulong *w, ulong n)
+    {
+        words = w;
+        numWords = n;
+        word = 0;
+        bits = (n > 0) ? w[0] : 0;
+    }
+
+    /**
+     * \brief Get the Next Processor in the Set
+     * \return Processor Number, -1 Once the Set is Exhausted
+     */
+    int next()
+    {
+        while(bits == 0)
+        {
+            if(++word >= numWords)
+            {
+                return -1;
+            }
+            bits = words[word];
+        }
+        int bit = __builtin_ctzl(bits);
+        bits &= bits - 1;
+
+        return (int)(word*SHARER_WORD_BITS) + bit;
+    }
+};
+
+/**
+ * \class sharerDirectory
+ * \brief Class Mapping Block Addresses to the Set of Caches Holding Them
+ *
+ * An open addressing hash table with linear probing keyed by block address
+ * (the full tag). Each entry carries a bit per processor; entries whose set
+ * becomes empty are removed with backward shift deletion so probe chains
+ * stay short. The coherence controller keeps it exact on every fill,
+ * eviction and invalidation, so a snoop only visits the caches that hold
+ * the block.
+ */
+class sharerDirectory
+{
+protected:
+    ulong numWords;         /**< Words per Sharer Set */
+    ulong capacity;         /**< Number of Slots, a Power of Two */
+    ulong log2Capacity;     /**< Bits Needed to Index a Slot */
+    ulong numEntries;       /**< Occupied Slots */
+    ulong *keys;            /**< Block Address Plus One per Slot, 0 for an Empty Slot */
+    ulong *sets;            /**< Sharer Set of Each Slot, numWords Words per Slot */
+
+    /**
+     * \brief Home Slot of a Key
+     * \param[in] key Stored Key (Block Address Plus One)
+     * \return Slot Where Probing Starts
+     */
+    ulong homeSlot(ulong key)
+    {
+        return (key * 0x9E3779B97F4A7C15UL) >> (64 - log2Capacity);
+    }
+
+    /**
+     * \brief Find the Slot of a Key
+     * \param[in] key Stored Key (Block Address Plus One)
+     * \return Slot Holding the Key, or the Empty Slot Ending its Probe Chain
+     */
+    ulong findSlot(ulong key)
+    {
+        ulong mask = capacity - 1;
+        ulong slot = homeSlot(key);
+        while((keys[slot] != 0) && (keys[slot] != key))
+        {
+            slot = (slot + 1) & mask;
+        }
+
+        return slot;
+    }
+
+    /**
+     * \brief Double the Table and Reinsert Every Entry
+     */
+    void grow();
+
+public:
+
+    /**
+     * \brief sharerDirectory Class Constructor
+     * \param[in] numProcessors Number of Processors that can Share a Block
+     */
+    sharerDirectory(uint numProcessors);
+
+    /**
+     * \brief sharerDirectory Class Destructor
+     */
+    ~sharerDirectory()
+    {
+        delete [] keys;
+        delete [] sets;
+    }
+
+    /**
+     * \brief Record that a Cache Now Holds a Block
+     * \param[in] block Block Address
+     * \param[in] procNum Processor Whose Cache Filled the Block
+     */
+    void add(ulong block, uint procNum);
+
+    /**
+     * \brief Record that a Cache No Longer Holds a Block
+     * \param[in] block Block Address
+     * \param[in] procNum Processor Whose Cache Evicted or Invalidated the Block
+     */
+    void remove(ulong block, uint procNum);
+
+    /**
+     * \brief Copy the Sharer Set of a Block
+     * \param[in] block Block Address
+     * \param[out] out numWords Words, All Zero if No Cache Holds the Block
+     */
+    void getSharers(ulong block, ulong *out);
+
+    /**
+     * \brief Get Words per Sharer Set
+     * \return Number of Words
+     */
+    ulong getNumWords()
+    {
+        return numWords;
+    }
+
+    /**
+     * \brief Get Number of Tracked Blocks
+     * \return Blocks Held by at Least One Cache
+     */
+    ulong getNumEntries()
+    {
+        return numEntries;
+    }
+};
+
+#endif
@@ -0,0 +1,228 @@
+/**
+ * \file sharing_profiler.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Per Block Sharing Profiler
+ */
+
+#include "sharing_profiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+
+using namespace std;
+
+bool parseProfileParams(const char *text, profileParams &params)
+{
+    uint *fields[] = {&params.entries, &params.top};
+    uint loop_f;
+    const char *p = text;
+
+    for(loop_f=0; (loop_f<sizeof(fields)/sizeof(fields[0])) && (*p != '\0'); loop_f++)
+    {
+        char *end;
+        unsigned long value = strtoul(p, &end, 10);
+
+        if((end == p) || (value < 1) || (value > (1UL << 24)))
+        {
+            return false;
+        }
+        *fields[loop_f] = (uint)value;
+
+        if(*end == ',')
+        {
+            end++;
+        }
+        else if(*end != '\0')
+        {
+            return false;
+        }
+        p = end;
+    }
+
+    return (*p == '\0');
+}
+
+sharingProfiler::sharingProfiler(const profileParams &p, int numP)
+{
+    params = p;
+    words = ((ulong)numP + 63)/64;
+    masks.assign(2*words*params.entries, 0);
+    entries.reserve(params.entries);
+    heap.reserve(params.entries);
+    index.reserve(params.entries);
+    totalWeight = 0;
+    evictions = 0;
+    begin(0, 0, false, false);
+}
+
+void sharingProfiler::swapHeap(uint a, uint b)
+{
+    uint tmp = heap[a];
+    heap[a] = heap[b];
+    heap[b] = tmp;
+    entries[heap[a]].heapPos = a;
+    entries[heap[b]].heapPos = b;
+}
+
+void sharingProfiler::siftDown(uint pos)
+{
+    uint size = (uint)heap.size();
+
+    while(true)
+    {
+        uint least = pos;
+        uint left = 2*pos + 1;
+        uint right = left + 1;
+
+        if((left < size) && (entries[heap[left]].weight < entries[heap[least]].weight))
+        {
+            least = left;
+        }
+        if((right < size) && (entries[heap[right]].weight < entries[heap[least]].weight))
+        {
+            least = right;
+        }
+        if(least == pos)
+        {
+            return;
+        }
+        swapHeap(pos, least);
+        pos = least;
+    }
+}
+
+void sharingProfiler::siftUp(uint pos)
+{
+    while(pos > 0)
+    {
+        uint parent = (pos - 1)/2;
+
+        if(entries[heap[parent]].weight <= entries[heap[pos]].weight)
+        {
+            return;
+        }
+        swapHeap(pos, parent);
+        pos = parent;
+    }
+}
+
+void sharingProfiler::end(bool transfer)
+{
+    ulong weight = curInvalidations + curInterventions + curUpdates + (transfer ? 1 : 0);
+    unordered_map<ulong, uint>::iterator it = index.find(curBlock);
+    blockProfile *entry;
+
+    if(it != index.end())
+    {
+        entry = &entries[it->second];
+    }
+    else if(weight == 0)
+    {
+        /** A Transaction Without Coherence Events Does Not Claim an Entry */
+        return;
+    }
+    else if(entries.size() < params.entries)
+    {
+        blockProfile fresh = blockProfile();
+        fresh.block = curBlock;
+        fresh.slot = (uint)entries.size();
+        fresh.heapPos = (uint)heap.size();
+        entries.push_back(fresh);
+        heap.push_back((uint)entries.size() - 1);
+        index[curBlock] = (uint)entries.size() - 1;
+        siftUp(fresh.heapPos);
+        entry = &entries.back();
+    }
+    else
+    {
+        /** Take Over the Lightest Entry, its Weight Bounds the New Block's Overcount */
+        uint slot = heap[0];
+        entry = &entries[slot];
+        index.erase(entry->block);
+        index[curBlock] = slot;
+
+        ulong inherited = entry->weight;
+        *entry = blockProfile();
+        entry->block = curBlock;
+        entry->weight = inherited;
+        entry->error = inherited;
+        entry->slot = slot;
+        entry->heapPos = 0;
+        fill(&masks[2*words*slot], &masks[2*words*(slot + 1)], 0UL);
+        evictions++;
+    }
+
+    entry->weight += weight;
+    entry->invalidations += curInvalidations;
+    entry->interventions += curInterventions;
+    entry->transfers += transfer ? 1 : 0;
+    entry->updates += curUpdates;
+    totalWeight += weight;
+
+    ulong *readers = &masks[2*words*entry->slot];
+    ulong *writers = readers + words;
+    ulong loop_p;
+    for(loop_p=0; loop_p<curReaders.size(); loop_p++)
+    {
+        readers[curReaders[loop_p]/64] |= 1UL << (curReaders[loop_p] % 64);
+    }
+    for(loop_p=0; loop_p<curWriters.size(); loop_p++)
+    {
+        writers[curWriters[loop_p]/64] |= 1UL << (curWriters[loop_p] % 64);
+    }
+
+    if(weight != 0)
+    {
+        siftDown(entry->heapPos);
+    }
+}
+
+/**
+ * \brief Order Profiles by Weight, Heaviest First
+ * \param[in] a Profile
+ * \param[in] b Profile
+ * \return Whether a Sorts Before b
+ */
+static bool heavierFirst(const blockProfile &a, const blockProfile &b)
+{
+    return (a.weight != b.weight) ? (a.weight > b.weight) : (a.block < b.block);
+}
+
+/**
+ * \brief Count the Processors in a Set
+ * \param[in] set Processor Set Words
+ * \param[in] words Number of Words
+ * \return Processors in the Set
+ */
+static ulong countSet(const ulong *set, ulong words)
+{
+    ulong count = 0, loop_w;
+
+    for(loop_w=0; loop_w<words; loop_w++)
+    {
+        count += __builtin_popcountl(set[loop_w]);
+    }
+
+    return count;
+}
+
+void sharingProfiler::dumpStats()
+{
+    vector<blockProfile> sorted(entries);
+    ulong loop_e;
+
+    sort(sorted.begin(), sorted.end(), heavierFirst);
+
+    printf("============ Sharing profile (top %u blocks) ============\n", params.top);
+    printf("coherence events: %lu\ttracked blocks: %lu of %u\tentries taken over: %lu\n", totalWeight, (ulong)entries.size(), params.entries, evictions);
+    printf("block\t\t\tevents\terror\tinval\tinterv\txfers\tupdates\treaders\twriters\n");
+    for(loop_e=0; (loop_e<sorted.size()) && (loop_e<params.top); loop_e++)
+    {
+        const blockProfile &entry = sorted[loop_e];
+        const ulong *readers = &masks[2*words*entry.slot];
+        printf("0x%016lx\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\n", entry.block, entry.weight, entry.error,
+               entry.invalidations, entry.interventions, entry.transfers, entry.updates,
+               countSet(readers, words), countSet(readers + words, words));
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * \file sharing_profiler.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Per Block Sharing Profiler
+ */
+
+#ifndef __SHARING_PROFILER_H__
+#define __SHARING_PROFILER_H__
+
+#include <unordered_map>
+#include <vector>
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/** Type define unsigned int as uint */
+typedef unsigned int uint;
+
+/**
+ * \struct profileParams
+ * \brief Size of the Sharing Profile
+ */
+struct profileParams
+{
+    uint entries;               /**< Blocks Tracked at Once, 0 to Not Profile */
+    uint top;                   /**< Blocks Printed at the End */
+
+    /**
+     * \brief profileParams Constructor, Profiling Off
+     */
+    profileParams()
+    {
+        entries = 0;
+        top = 20;
+    }
+};
+
+/**
+ * \brief Parse "entries,top", a Missing Trailing Field Keeps its Value
+ * \param[in] text Comma Separated Sizes
+ * \param[in,out] params Profile Sizes
+ * \return Whether the Text was Valid
+ */
+bool parseProfileParams(const char *text, profileParams &params);
+
+/**
+ * \struct blockProfile
+ * \brief Sharing Counts of One Tracked Block
+ */
+struct blockProfile
+{
+    ulong block;                /**< Block Address */
+    ulong weight;               /**< Coherence Events Charged to the Block, Including error */
+    ulong error;                /**< Events Inherited from the Evicted Block, an Upper Bound of the Overcount */
+    ulong invalidations;        /**< Copies Invalidated */
+    ulong interventions;        /**< Interventions on Dirty or Exclusive Copies */
+    ulong transfers;            /**< Cache to Cache Transfers */
+    ulong updates;              /**< Copies Updated by a Dragon Update Word */
+    uint slot;                  /**< Index of the Entry, Locating its Reader and Writer Sets */
+    uint heapPos;               /**< Position in the Weight Heap */
+};
+
+/**
+ * \class sharingProfiler
+ * \brief Class Finding the Blocks Causing the Most Coherence Traffic
+ *
+ * A space saving sketch: a fixed number of entries, a hash index and a
+ * min heap by weight. A block with a coherence event that is not tracked
+ * takes over the lightest entry and inherits its weight as error, so every
+ * block whose true weight exceeds the total divided by the entry count is
+ * guaranteed to be tracked, in bounded memory whatever the trace length.
+ *
+ * A block's weight counts the copies invalidated, the interventions, the
+ * cache to cache transfers and the copies updated by Dragon update words
+ * it caused. The controller reports each bus transaction: its requester,
+ * then every snooped copy, then the transfer. Readers and writers are
+ * learnt from the requesters and from the states of snooped copies, and
+ * kept as a bit per processor, so they are exact at any processor count.
+ * A transaction lists the processors it saw and only sets their bits, so
+ * its cost follows the copies snooped, not the processor count.
+ */
+class sharingProfiler
+{
+protected:
+    profileParams params;                       /**< Profile Sizes */
+    std::vector<blockProfile> entries;          /**< Tracked Blocks */
+    std::vector<uint> heap;                     /**< Entry Indices, Min Heap by Weight */
+    std::unordered_map<ulong, uint> index;      /**< Entry Index of Each Tracked Block */
+    std::vector<ulong> masks;                   /**< Reader then Writer Set of Each Entry, words Words Each */
+    ulong words;                                /**< Words of a Processor Set */
+    ulong totalWeight;                          /**< Coherence Events Seen */
+    ulong evictions;                            /**< Entries Taken Over by Another Block */
+
+    ulong curBlock;                             /**< Block of the Transaction Being Reported */
+    std::vector<ulong> curReaders;              /**< Readers Seen in the Transaction */
+    std::vector<ulong> curWriters;              /**< Writers Seen in the Transaction */
+    uint curInvalidations;                      /**< Copies Invalidated by the Transaction */
+    uint curInterventions;                      /**< Interventions Caused by the Transaction */
+    uint curUpdates;                            /**< Copies Updated by the Transaction */
+    bool curIsUpdate;                           /**< Whether the Transaction Carries an Update Word */
+
+    /**
+     * \brief Restore the Heap Below a Position After its Weight Grew
+     * \param[in] pos Heap Position
+     */
+    void siftDown(uint pos);
+
+    /**
+     * \brief Restore the Heap Above a Position After an Insert
+     * \param[in] pos Heap Position
+     */
+    void siftUp(uint pos);
+
+    /**
+     * \brief Swap Two Heap Positions
+     * \param[in] a Heap Position
+     * \param[in] b Heap Position
+     */
+    void swapHeap(uint a, uint b);
+
+public:
+
+    /**
+     * \brief sharingProfiler Class Constructor
+     * \param[in] p Profile Sizes
+     * \param[in] numP Number of Processors
+     */
+    sharingProfiler(const profileParams &p, int numP);
+
+    /**
+     * \brief Start Reporting a Bus Transaction
+     * \param[in] block Block Address
+     * \param[in] procNum Requesting Processor
+     * \param[in] write Whether the Requester is Writing
+     * \param[in] update Whether the Transaction Carries an Update Word to the Other Copies
+     */
+    void begin(ulong block, ulong procNum, bool write, bool update)
+    {
+        curBlock = block;
+        curReaders.clear();
+        curWriters.clear();
+        (write ? curWriters : curReaders).push_back(procNum);
+        curInvalidations = 0;
+        curInterventions = 0;
+        curUpdates = 0;
+        curIsUpdate = update;
+    }
+
+    /**
+     * \brief Report One Snooped Copy of the Block
+     * \param[in] procNum Processor Holding the Copy
+     * \param[in] dirty Whether the Copy was Dirty, So its Holder Wrote it
+     * \param[in] invalidated Whether the Copy was Invalidated
+     * \param[in] intervened Whether the Snoop was an Intervention
+     */
+    void snooped(ulong procNum, bool dirty, bool invalidated, bool intervened)
+    {
+        (dirty ? curWriters : curReaders).push_back(procNum);
+        curInvalidations += invalidated;
+        curInterventions += intervened;
+        curUpdates += (curIsUpdate && !invalidated);
+    }
+
+    /**
+     * \brief Finish Reporting a Bus Transaction
+     * \param[in] transfer Whether Another Cache Supplied the Block
+     */
+    void end(bool transfer);
+
+    /**
+     * \brief Print the Heaviest Blocks
+     */
+    void dumpStats();
+};
+
+#endif
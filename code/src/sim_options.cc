@@ -0,0 +1,219 @@
+/**
+ * \file sim_options.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Simulator Command Line Options
+ */
+
+#include "sim_options.h"
+#include "pipeline.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * \brief Match an Option Name and Get its Value
+ * \param[in] arg Command Line Argument
+ * \param[in] name Option Name Including the Trailing '='
+ * \param[out] value Text After the '='
+ * \return Whether arg is the Named Option
+ */
+static bool matchOption(const char *arg, const char *name, const char *&value)
+{
+    size_t len = strlen(name);
+    if(strncmp(arg, name, len) != 0)
+    {
+        return false;
+    }
+    value = arg + len;
+
+    return true;
+}
+
+int parseOptions(int argc, char *argv[], simOptions &opts)
+{
+    int argi = 1;
+    const char *value;
+
+    while((argi < argc) && (strncmp(argv[argi], "--", 2) == 0))
+    {
+        if(matchOption(argv[argi], "--sweep=", value))
+        {
+            opts.sweepFile = value;
+        }
+        else if(matchOption(argv[argi], "--threads=", value))
+        {
+            opts.numThreads = atoi(value);
+        }
+        else if(matchOption(argv[argi], "--shards=", value))
+        {
+            opts.numShards = atoi(value);
+        }
+        else if(strcmp(argv[argi], "--pipeline") == 0)
+        {
+            opts.pipelineRing = PIPELINE_RING_RECORDS;
+        }
+        else if(matchOption(argv[argi], "--pipeline=", value))
+        {
+            /** The Ring Needs at Least One Slot, Zero Would Silently Turn Pipelining Off */
+            char *end;
+            opts.pipelineRing = strtoul(value, &end, 0);
+            if((end == value) || (*end != '\0') || (opts.pipelineRing == 0))
+            {
+                printf("Bad pipeline ring size: %s\n", value);
+                return -1;
+            }
+        }
+        else if(matchOption(argv[argi], "--repl=", value))
+        {
+            if(!parseReplPolicy(value, opts.repl))
+            {
+                printf("Unknown replacement policy: %s\n", value);
+                return -1;
+            }
+        }
+        else if(strcmp(argv[argi], "--timing") == 0)
+        {
+            opts.timing = true;
+        }
+        else if(matchOption(argv[argi], "--timing=", value))
+        {
+            if(!parseTimingParams(value, opts.latencies))
+            {
+                printf("Bad timing latencies: %s\n", value);
+                return -1;
+            }
+            opts.timing = true;
+        }
+        else if(strcmp(argv[argi], "--traffic") == 0)
+        {
+            opts.traffic.report = true;
+        }
+        else if(matchOption(argv[argi], "--traffic=", value))
+        {
+            if(!parseTrafficParams(value, opts.traffic))
+            {
+                printf("Bad bus traffic sizes: %s\n", value);
+                return -1;
+            }
+            opts.traffic.report = true;
+        }
+        else if(matchOption(argv[argi], "--bus=", value))
+        {
+            if(strcmp(value, "atomic") == 0)
+            {
+                opts.latencies.bus = BUS_ATOMIC;
+            }
+            else if(strcmp(value, "split") == 0)
+            {
+                opts.latencies.bus = BUS_SPLIT;
+            }
+            else
+            {
+                printf("Unknown bus model: %s\n", value);
+                return -1;
+            }
+            opts.timing = true;
+        }
+        else if(matchOption(argv[argi], "--arb=", value))
+        {
+            if(!parseArbPolicy(value, opts.latencies.arb))
+            {
+                printf("Unknown arbitration policy: %s\n", value);
+                return -1;
+            }
+            opts.timing = true;
+        }
+        else if(matchOption(argv[argi], "--outstanding=", value))
+        {
+            opts.latencies.maxOutstanding = (uint)atoi(value);
+            if(opts.latencies.maxOutstanding < 1)
+            {
+                printf("Bad outstanding transaction count: %s\n", value);
+                return -1;
+            }
+            opts.timing = true;
+        }
+        else if(matchOption(argv[argi], "--interval=", value))
+        {
+            if(!parseIntervalParams(value, opts.intervals))
+            {
+                printf("Bad interval length: %s\n", value);
+                return -1;
+            }
+        }
+        else if(matchOption(argv[argi], "--interval-file=", value))
+        {
+            opts.intervals.fileName = value;
+        }
+        else if(strcmp(argv[argi], "--profile") == 0)
+        {
+            opts.profile.entries = 4096;
+        }
+        else if(matchOption(argv[argi], "--profile=", value))
+        {
+            opts.profile.entries = 4096;
+            if(!parseProfileParams(value, opts.profile))
+            {
+                printf("Bad sharing profile sizes: %s\n", value);
+                return -1;
+            }
+        }
+        else if(matchOption(argv[argi], "--layout=", value))
+        {
+            if(!parseTagLayout(value, opts.layout))
+            {
+                printf("Unknown tag layout: %s\n", value);
+                return -1;
+            }
+        }
+        else if(matchOption(argv[argi], "--directory=", value))
+        {
+            if(!parseDirectoryParams(value, opts.directory))
+            {
+                printf("Unknown directory organization: %s\n", value);
+                return -1;
+            }
+        }
+        else if(matchOption(argv[argi], "--format=", value))
+        {
+            if(!parseOutputFormat(value, opts.format))
+            {
+                printf("Unknown output format: %s\n", value);
+                return -1;
+            }
+        }
+        else
+        {
+            printf("Unknown option: %s\n", argv[argi]);
+            return -1;
+        }
+        argi++;
+    }
+
+    return argi;
+}
+
+void printUsage()
+{
+    printf("input format: ");
+    printf("./smp_cache [options] <cache_size> <assoc> <block_size> <num_processors> <protocol> <trace_file> \n");
+    printf("             ./smp_cache --sweep=<config_file> [options] <trace_file> \n");
+    printf("options:\n");
+    printf("  --sweep=<config_file>   simulate every configuration in the file from one pass over the trace\n");
+    printf("  --threads=<n>           sweep worker threads (0: one per hardware thread, default 1)\n");
+    printf("  --pipeline[=<records>]  decode the trace on its own thread through a ring of the given size (default %d)\n", PIPELINE_RING_RECORDS);
+    printf("  --shards=<n>            split a single run by cache set over n threads (0: one per hardware thread, default 1)\n");
+    printf("  --repl=<policy>         replacement policy: lru, tree-plru, bit-plru, srrip, brrip or random (default lru)\n");
+    printf("  --layout=<layout>       tag storage: private per cache (default) or interleaved by set across caches\n");
+    printf("  --format=<format>       metrics as text (default), json (one object per run) or csv (one row per run)\n");
+    printf("  --interval=<length>     write counter deltas every interval: <n> or refs:<n> references, bus:<n> bus transactions\n");
+    printf("  --interval-file=<file>  file the interval deltas are written to (default intervals.csv)\n");
+    printf("  --profile[=<n,top>]     profile coherence events by block in n entries, print the top blocks (default 4096,20)\n");
+    printf("  --directory=<org>       count directory messages: full, dir<i>b (broadcast), dir<i>nb (no broadcast) or dir<i>cv (coarse vector)\n");
+    printf("  --traffic[=<cmd,word>]  report bus bytes, command and update word sizes in bytes (default 8,4)\n");
+    printf("  --timing[=<latencies>]  estimate cycles, latencies \"hit,arb,xfer,c2c,mem\" (default 1,2,8,20,100)\n");
+    printf("  --bus=<model>           timed bus: atomic (default) or split transaction, implies --timing\n");
+    printf("  --arb=<policy>          split bus arbitration: rr (default), fixed or fcfs\n");
+    printf("  --outstanding=<n>       split bus transactions awaiting their response at once (default 4)\n");
+}
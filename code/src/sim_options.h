@@ -0,0 +1,72 @@
+/**
+ * \file sim_options.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Simulator Command Line Options
+ */
+
+#ifndef __SIM_OPTIONS_H__
+#define __SIM_OPTIONS_H__
+
+#include "repl_policy.h"
+#include "timing_model.h"
+#include "bus_traffic.h"
+#include "metrics_output.h"
+#include "interval_stats.h"
+#include "sharing_profiler.h"
+#include "directory.h"
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/**
+ * \struct simOptions
+ * \brief Options Given as Leading --name=value Arguments
+ */
+struct simOptions
+{
+    const char *sweepFile;      /**< Sweep Configuration File, NULL for a Single Run */
+    int numThreads;             /**< Worker Threads, 0 for One per Hardware Thread */
+    int numShards;              /**< Set Shards of a Single Run, 1 for a Serial Run */
+    ulong pipelineRing;         /**< Ring Capacity in Records of a Pipelined Run, 0 to Not Pipeline */
+    enum replKind repl;         /**< Replacement Policy of Every Cache */
+    bool timing;                /**< Run the Timing Model */
+    timingParams latencies;     /**< Latencies of the Timing Model */
+    trafficParams traffic;      /**< Bytes Charged to Bus Transactions */
+    enum outputFormat format;   /**< Metrics Output Format */
+    intervalParams intervals;   /**< Interval Statistics Sampling */
+    profileParams profile;      /**< Per Block Sharing Profile */
+    enum tagLayout layout;      /**< Tag and State Storage Layout */
+    directoryParams directory;  /**< Directory Organization Whose Messages are Counted */
+
+    /**
+     * \brief simOptions Constructor, Default Options
+     */
+    simOptions()
+    {
+        sweepFile = 0;
+        numThreads = 1;
+        numShards = 1;
+        pipelineRing = 0;
+        repl = REPL_LRU;
+        timing = false;
+        format = FORMAT_TEXT;
+        layout = LAYOUT_PRIVATE;
+    }
+};
+
+/**
+ * \brief Parse the Leading Options of the Command Line
+ * \param[in] argc Argument Count
+ * \param[in] argv Argument Vector
+ * \param[out] opts Parsed Options
+ * \return Index of the First Positional Argument, -1 on a Bad Option
+ */
+int parseOptions(int argc, char *argv[], simOptions &opts);
+
+/**
+ * \brief Print the Command Line Usage
+ */
+void printUsage();
+
+#endif
@@ -0,0 +1,407 @@
+/**
+ * \file split_bus.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Split Transaction Bus Timing Model
+ */
+
+#include "split_bus.h"
+#include <stdio.h>
+
+using namespace std;
+
+/** No Eligible Request */
+#define NO_REQUEST (~0UL)
+
+splitTiming::splitTiming(const timingParams &p, int numP) : timingModel(p, numP)
+{
+    pending.resize(numP);
+    writebacks.resize(numP);
+    phase.assign(numP, PHASE_IDLE);
+    reqReady.assign(numP, 0);
+    reqStart.assign(numP, 0);
+    reqSource.assign(numP, SRC_NONE);
+    delayHist.assign((ulong)numP*SPLIT_HIST_BUCKETS, 0);
+    maxDelay.assign(numP, 0);
+    buffered = 0;
+    pendingCount = 0;
+    rrNext = 0;
+    idleProcs = numP;
+    absent.assign(numP, 0);
+    absentProcs = 0;
+    lastAccess.assign(numP, 0);
+    accessCount = 0;
+    readyBits[0].assign(((ulong)numP + 63)/64, 0);
+    readyBits[1].assign(((ulong)numP + 63)/64, 0);
+    readyCount.assign(numP, 0);
+
+    if(params.maxOutstanding < 1)
+    {
+        params.maxOutstanding = 1;
+    }
+}
+
+void splitTiming::access(ulong procNum, bool usesBus, enum timingSource source, bool writeback)
+{
+    if((phase[procNum] == PHASE_IDLE) && pending[procNum].empty())
+    {
+        wake.push_back((int)procNum);
+    }
+    if(absent[procNum])
+    {
+        /** Time Went On Without the Processor, it Rejoins at the Bus's Cycle */
+        absent[procNum] = 0;
+        absentProcs--;
+        if(clock[procNum] < busFree)
+        {
+            clock[procNum] = busFree;
+        }
+    }
+    pending[procNum].push_back(encode(usesBus, source, writeback));
+    pendingCount++;
+    lastAccess[procNum] = ++accessCount;
+
+    if(++buffered >= SPLIT_WINDOW)
+    {
+        buffered = 0;
+        advance(false);
+
+        /** A Processor Holding Back a Full Buffer that Issued None of it is Taken to be Gone */
+        if(pendingCount >= SPLIT_PENDING_LIMIT)
+        {
+            int loop_p;
+            for(loop_p=0; loop_p<numProcessors; loop_p++)
+            {
+                if((phase[loop_p] == PHASE_IDLE) && pending[loop_p].empty() && !absent[loop_p] && (accessCount - lastAccess[loop_p] >= SPLIT_PENDING_LIMIT))
+                {
+                    absent[loop_p] = 1;
+                    absentProcs++;
+                }
+            }
+            advance(false);
+        }
+    }
+}
+
+void splitTiming::issue()
+{
+    /** Processors Run Independently Up to the Bus, So Only Woken Ones Need Visiting, in Any Order */
+    while(!wake.empty())
+    {
+        int proc = wake.back();
+        wake.pop_back();
+
+        while((phase[proc] == PHASE_IDLE) && !pending[proc].empty())
+        {
+            uchar rec = pending[proc].front();
+            pending[proc].pop_front();
+            pendingCount--;
+
+            ulong start = clock[proc];
+            ulong now = start + params.hitLatency;
+            accesses[proc]++;
+            clock[proc] = now;
+
+            if((rec & 1) == 0)
+            {
+                accessCycles[proc] += params.hitLatency;
+                continue;
+            }
+
+            phase[proc] = PHASE_REQUEST;
+            idleProcs--;
+            reqReady[proc] = now;
+            reqStart[proc] = start;
+            reqSource[proc] = (rec >> 1) & 3;
+            queueRequest(proc, now, reqSource[proc] != SRC_NONE);
+
+            if(rec & 8)
+            {
+                writebacks[proc].push_back(now);
+                queueRequest(proc, now, false);
+            }
+        }
+    }
+}
+
+ulong splitTiming::requestReady(int proc, bool &isWriteback)
+{
+    ulong ready = NO_REQUEST;
+    isWriteback = false;
+
+    /** A Transaction with a Response Phase Needs a Free Outstanding Slot */
+    if((phase[proc] == PHASE_REQUEST) && ((reqSource[proc] == SRC_NONE) || (outstanding.size() < params.maxOutstanding)))
+    {
+        ready = reqReady[proc];
+    }
+
+    if(!writebacks[proc].empty() && (writebacks[proc].front() < ready))
+    {
+        ready = writebacks[proc].front();
+        isWriteback = true;
+    }
+
+    return ready;
+}
+
+void splitTiming::queueRequest(int proc, ulong ready, bool response)
+{
+    waiting[response].insert(waitingRequest(ready, proc));
+    future[response].push(waitingRequest(ready, proc));
+}
+
+void splitTiming::dequeueRequest(int proc, ulong ready, bool response)
+{
+    waiting[response].erase(waiting[response].find(waitingRequest(ready, proc)));
+
+    /** A Processor has at Most One Request Needing a Response, but May Have Several Writebacks */
+    if(!response && (--readyCount[proc] > 0))
+    {
+        return;
+    }
+    readyBits[response][proc/64] &= ~(1UL << (proc % 64));
+}
+
+void splitTiming::markReady(ulong now)
+{
+    int loop_r;
+
+    for(loop_r=0; loop_r<2; loop_r++)
+    {
+        while(!future[loop_r].empty() && (future[loop_r].top().first <= now))
+        {
+            int proc = future[loop_r].top().second;
+            future[loop_r].pop();
+
+            if(loop_r == 0)
+            {
+                readyCount[proc]++;
+            }
+            readyBits[loop_r][proc/64] |= 1UL << (proc % 64);
+        }
+    }
+}
+
+int splitTiming::arbitrate(ulong now, bool responses)
+{
+    /** Earliest Ready Request, the Lowest Processor on a Tie */
+    if(params.arb == ARB_FCFS)
+    {
+        if(responses && !waiting[1].empty() && (waiting[0].empty() || (*waiting[1].begin() < *waiting[0].begin())))
+        {
+            return waiting[1].begin()->second;
+        }
+        return waiting[0].begin()->second;
+    }
+
+    /** First Ready Processor from the Highest Priority One, Wrapping Around */
+    ulong words = readyBits[0].size();
+    ulong start = (params.arb == ARB_ROUND_ROBIN) ? (ulong)rrNext : 0;
+    ulong loop_w;
+
+    for(loop_w=0; loop_w<=words; loop_w++)
+    {
+        ulong word = (start/64 + loop_w) % words;
+        ulong bits = readyBits[0][word] | (responses ? readyBits[1][word] : 0);
+
+        if(loop_w == 0)
+        {
+            bits &= ~0UL << (start % 64);
+        }
+        if(bits != 0)
+        {
+            return (int)(word*64 + __builtin_ctzl(bits));
+        }
+    }
+
+    return -1;
+}
+
+void splitTiming::recordDelay(int proc, ulong delay)
+{
+    int bucket = 0;
+
+    while((delay >> bucket) != 0)
+    {
+        bucket++;
+    }
+    if(bucket >= SPLIT_HIST_BUCKETS)
+    {
+        bucket = SPLIT_HIST_BUCKETS - 1;
+    }
+
+    delayHist[(ulong)proc*SPLIT_HIST_BUCKETS + bucket]++;
+    waitCycles[proc] += delay;
+    if(delay > maxDelay[proc])
+    {
+        maxDelay[proc] = delay;
+    }
+}
+
+void splitTiming::advance(bool drain)
+{
+    while(true)
+    {
+        issue();
+
+        /** A Processor's Next Access is Unknown Until the Trace Gives it, issue Leaves No Idle Processor with One */
+        if(!drain && (idleProcs > absentProcs))
+        {
+            return;
+        }
+
+        /** Oldest Response */
+        ulong respReady = NO_REQUEST;
+        ulong resp = 0, loop_o;
+        for(loop_o=0; loop_o<outstanding.size(); loop_o++)
+        {
+            if(outstanding[loop_o].dataReady < respReady)
+            {
+                respReady = outstanding[loop_o].dataReady;
+                resp = loop_o;
+            }
+        }
+
+        /** Earliest Request, One Needing a Response Phase Only if a Slot is Free */
+        bool responses = (outstanding.size() < params.maxOutstanding);
+        ulong reqTime = waiting[0].empty() ? NO_REQUEST : waiting[0].begin()->first;
+        if(responses && !waiting[1].empty() && (waiting[1].begin()->first < reqTime))
+        {
+            reqTime = waiting[1].begin()->first;
+        }
+
+        if((respReady == NO_REQUEST) && (reqTime == NO_REQUEST))
+        {
+            return;
+        }
+
+        ulong now = (respReady < reqTime) ? respReady : reqTime;
+        if(now < busFree)
+        {
+            now = busFree;
+        }
+
+        /** Response Phase: One Block Transfer, Then the Processor Resumes */
+        if(respReady <= now)
+        {
+            int proc = outstanding[resp].proc;
+            outstanding[resp] = outstanding.back();
+            outstanding.pop_back();
+
+            busFree = now + params.busXferLatency;
+            busCycles[proc] += params.busXferLatency;
+            clock[proc] = busFree;
+            accessCycles[proc] += busFree - reqStart[proc];
+            phase[proc] = PHASE_IDLE;
+            idleProcs++;
+            wake.push_back(proc);
+            continue;
+        }
+
+        /** Request Phase: Arbitrate Among Requests Ready by Now */
+        markReady(now);
+        bool grantWriteback;
+        int grant = arbitrate(now, responses);
+        ulong grantReady = requestReady(grant, grantWriteback);
+
+        recordDelay(grant, now - grantReady);
+        if(params.arb == ARB_ROUND_ROBIN)
+        {
+            rrNext = (grant + 1) % numProcessors;
+        }
+
+        ulong hold = params.busArbLatency + params.busXferLatency;
+
+        /** A Posted Writeback Carries its Data in the Request */
+        if(grantWriteback)
+        {
+            hold += params.busXferLatency;
+            dequeueRequest(grant, grantReady, false);
+            writebacks[grant].pop_front();
+            busFree = now + hold;
+            busCycles[grant] += hold;
+            continue;
+        }
+
+        busFree = now + hold;
+        busCycles[grant] += hold;
+        dequeueRequest(grant, grantReady, reqSource[grant] != SRC_NONE);
+
+        if(reqSource[grant] == SRC_NONE)
+        {
+            clock[grant] = busFree;
+            accessCycles[grant] += busFree - reqStart[grant];
+            phase[grant] = PHASE_IDLE;
+            idleProcs++;
+            wake.push_back(grant);
+        }
+        else
+        {
+            inflight tx;
+            tx.dataReady = busFree + ((reqSource[grant] == SRC_CACHE) ? params.c2cLatency : params.memLatency);
+            tx.proc = grant;
+            outstanding.push_back(tx);
+            phase[grant] = PHASE_DATA;
+        }
+    }
+}
+
+void splitTiming::dumpStats()
+{
+    advance(true);
+    timingModel::dumpStats();
+
+    int loop_p, loop_b, lastBucket = 0;
+
+    for(loop_p=0; loop_p<numProcessors; loop_p++)
+    {
+        for(loop_b=0; loop_b<SPLIT_HIST_BUCKETS; loop_b++)
+        {
+            if(delayHist[(ulong)loop_p*SPLIT_HIST_BUCKETS + loop_b] && (loop_b > lastBucket))
+            {
+                lastBucket = loop_b;
+            }
+        }
+    }
+
+    printf("============ Bus queueing delay (cycles) ============\n");
+    printf("delay:  ");
+    for(loop_b=0; loop_b<=lastBucket; loop_b++)
+    {
+        if(loop_b < 2)
+        {
+            printf("\t%d", loop_b);
+        }
+        else
+        {
+            printf("\t%lu-%lu", 1UL << (loop_b - 1), (1UL << loop_b) - 1);
+        }
+    }
+    printf("\n");
+
+    for(loop_p=0; loop_p<numProcessors; loop_p++)
+    {
+        const ulong *hist = &delayHist[(ulong)loop_p*SPLIT_HIST_BUCKETS];
+        ulong grants = 0, seen = 0, p99 = 0;
+
+        printf("Cache %d:", loop_p);
+        for(loop_b=0; loop_b<=lastBucket; loop_b++)
+        {
+            printf("\t%lu", hist[loop_b]);
+            grants += hist[loop_b];
+        }
+
+        /** 99th Percentile as the Upper Bound of its Bucket */
+        for(loop_b=0; (loop_b<SPLIT_HIST_BUCKETS) && grants; loop_b++)
+        {
+            seen += hist[loop_b];
+            if(seen*100 >= grants*99)
+            {
+                p99 = (loop_b == 0) ? 0 : (1UL << loop_b) - 1;
+                break;
+            }
+        }
+
+        printf("\tmean %.2f\tp99 <= %lu\tmax %lu\n", grants ? (double)waitCycles[loop_p]/grants : 0.0, p99, maxDelay[loop_p]);
+    }
+}
@@ -0,0 +1,199 @@
+/**
+ * \file split_bus.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Split Transaction Bus Timing Model
+ */
+
+#ifndef __SPLIT_BUS_H__
+#define __SPLIT_BUS_H__
+
+#include <deque>
+#include <functional>
+#include <queue>
+#include <set>
+#include <vector>
+
+#include "timing_model.h"
+
+/** Queueing Delay Histogram Buckets, Bucket k > 0 Holds Delays in [2^(k-1), 2^k) */
+#define SPLIT_HIST_BUCKETS 20
+
+/** Accesses Buffered Between Two Advances of the Bus Schedule */
+#define SPLIT_WINDOW 4096
+
+/** Accesses a Processor Must Miss Out, and Accesses Buffered, Before it Stops Holding Back the Schedule */
+#define SPLIT_PENDING_LIMIT (64*SPLIT_WINDOW)
+
+/**
+ * \class splitTiming
+ * \brief Timing Model of a Split Transaction Bus
+ *
+ * Coherence state is still updated in trace order; only time is modeled
+ * here. Each processor runs its own accesses in order and blocks on a bus
+ * transaction. A transaction is a request phase (arbitration and address)
+ * and, when data moves, a response phase (one transfer) once the supplier's
+ * latency has passed, leaving the bus free in between. At most
+ * maxOutstanding transactions wait between the two phases. Responses are
+ * granted before requests, oldest first, and requests by the arbitration
+ * policy. A dirty victim's writeback is a posted request carrying data.
+ *
+ * Accesses are buffered per processor and the bus is scheduled once every
+ * processor has a buffered access, so a processor's next access is known
+ * before time passes it. A processor that stops issuing, or never issues,
+ * would hold every later access in the buffer, so once SPLIT_PENDING_LIMIT
+ * accesses are buffered, processors that made none of the last
+ * SPLIT_PENDING_LIMIT accesses are taken to be absent: the bus is scheduled
+ * without them, and one that issues again resumes at the bus's current
+ * cycle.
+ *
+ * Waiting requests are kept ordered by ready cycle, and those ready by
+ * the current cycle as bits per processor, so finding the next request,
+ * and arbitrating among the ready ones, costs a logarithm or a word per
+ * 64 processors rather than a visit to every processor.
+ */
+class splitTiming : public timingModel
+{
+protected:
+
+    /** Processor Activity */
+    enum procPhase  {
+                        PHASE_IDLE =    0,  /**< Running Accesses that Need No Bus */
+                        PHASE_REQUEST = 1,  /**< Waiting for a Request Phase Grant */
+                        PHASE_DATA =    2   /**< Waiting for its Response Phase */
+    };
+
+    /**
+     * \struct inflight
+     * \brief Transaction Between its Request and Response Phases
+     */
+    struct inflight
+    {
+        ulong dataReady;        /**< Cycle the Supplier has the Data */
+        int proc;               /**< Processor Waiting for it */
+    };
+
+    /** Request Phase Waiting for a Grant, Ordered by Ready Cycle then Processor */
+    typedef std::pair<ulong, int> waitingRequest;
+
+    /** Requests Not Yet Ready, Earliest First */
+    typedef std::priority_queue<waitingRequest, std::vector<waitingRequest>, std::greater<waitingRequest> > futureQueue;
+
+    std::vector< std::deque<uchar> > pending;       /**< Buffered Accesses per Processor, Encoded by encode() */
+    std::vector< std::deque<ulong> > writebacks;    /**< Ready Cycles of Posted Writebacks per Processor */
+    std::vector<enum procPhase> phase;              /**< Activity per Processor */
+    std::vector<ulong> reqReady;                    /**< Cycle the Blocking Request Became Ready */
+    std::vector<ulong> reqStart;                    /**< Cycle the Blocked Access Started */
+    std::vector<uchar> reqSource;                   /**< timingSource of the Blocking Request */
+    std::vector<inflight> outstanding;              /**< Transactions Awaiting their Response Phase */
+    std::vector<ulong> delayHist;                   /**< Queueing Delay Histogram, [proc*SPLIT_HIST_BUCKETS + bucket] */
+    std::vector<ulong> maxDelay;                    /**< Longest Queueing Delay per Processor */
+    ulong buffered;                                 /**< Accesses Buffered Since the Last Advance */
+    ulong pendingCount;                             /**< Accesses Buffered and Not Yet Issued */
+    int rrNext;                                     /**< Processor with the Highest Round Robin Priority */
+    std::vector<int> wake;                          /**< Processors that May Have Accesses to Issue */
+    int idleProcs;                                  /**< Processors in PHASE_IDLE */
+    std::vector<uchar> absent;                      /**< Whether an Idle Processor No Longer Holds Back the Schedule */
+    int absentProcs;                                /**< Processors Marked absent */
+    std::vector<ulong> lastAccess;                  /**< accessCount at Each Processor's Latest Access */
+    ulong accessCount;                              /**< Accesses Buffered Since the Start */
+
+    /** Posted Writebacks and Requests Moving No Data [0], Requests Needing a Response Phase [1] */
+    std::multiset<waitingRequest> waiting[2];       /**< Every Waiting Request */
+    futureQueue future[2];                          /**< Waiting Requests Not Yet Marked Ready */
+    std::vector<ulong> readyBits[2];                /**< Processors with a Request Ready by the Last Cycle Scheduled */
+    std::vector<uint> readyCount;                   /**< Requests of waiting[0] per Processor Marked Ready */
+
+    /**
+     * \brief Pack an Access into One Byte
+     * \param[in] usesBus Whether the Access Placed a Command on the Bus
+     * \param[in] source Data Source of the Bus Transaction
+     * \param[in] writeback Whether a Dirty Victim was Written Back
+     * \return Packed Access
+     */
+    static uchar encode(bool usesBus, enum timingSource source, bool writeback)
+    {
+        return (uchar)((usesBus ? 1 : 0) | ((uint)source << 1) | (writeback ? 8 : 0));
+    }
+
+    /**
+     * \brief Run Buffered Accesses of Idle Processors Up to their Next Bus Request
+     */
+    void issue();
+
+    /**
+     * \brief Get the Cycle a Processor's Next Request Could be Granted
+     * \param[in] proc Processor Number
+     * \param[out] isWriteback Whether that Request is a Posted Writeback
+     * \return Ready Cycle, ~0UL if the Processor has No Eligible Request
+     */
+    ulong requestReady(int proc, bool &isWriteback);
+
+    /**
+     * \brief Add a Waiting Request
+     * \param[in] proc Processor Number
+     * \param[in] ready Cycle it Becomes Ready
+     * \param[in] response Whether it Needs a Response Phase
+     */
+    void queueRequest(int proc, ulong ready, bool response);
+
+    /**
+     * \brief Remove a Granted Request, it Must be Marked Ready
+     * \param[in] proc Processor Number
+     * \param[in] ready Cycle it Became Ready
+     * \param[in] response Whether it Needs a Response Phase
+     */
+    void dequeueRequest(int proc, ulong ready, bool response);
+
+    /**
+     * \brief Mark the Requests Ready by a Cycle
+     * \param[in] now Cycle Being Scheduled, Never Decreasing
+     */
+    void markReady(ulong now);
+
+    /**
+     * \brief Pick the Processor Granted the Request Phase
+     * \param[in] now Cycle Being Scheduled, After markReady
+     * \param[in] responses Whether a Response Phase Slot is Free
+     * \return Processor Number, One has a Request Ready
+     */
+    int arbitrate(ulong now, bool responses);
+
+    /**
+     * \brief Record the Queueing Delay of a Granted Request
+     * \param[in] proc Processor Number
+     * \param[in] delay Cycles from Ready to Grant
+     */
+    void recordDelay(int proc, ulong delay);
+
+    /**
+     * \brief Schedule the Bus
+     * \param[in] drain Whether the Trace has Ended, Otherwise Stop When a Processor Runs Out of Buffered Accesses
+     */
+    void advance(bool drain);
+
+public:
+
+    /**
+     * \brief splitTiming Class Constructor
+     * \param[in] p Latencies and Bus Organization
+     * \param[in] numP Number of Processors
+     */
+    splitTiming(const timingParams &p, int numP);
+
+    /**
+     * \brief Buffer One Access, Scheduling the Bus Every SPLIT_WINDOW Accesses
+     * \param[in] procNum Processor Making the Access
+     * \param[in] usesBus Whether the Access Placed a Command on the Bus
+     * \param[in] source Data Source of the Bus Transaction
+     * \param[in] writeback Whether a Dirty Victim was Written Back
+     */
+    void access(ulong procNum, bool usesBus, enum timingSource source, bool writeback);
+
+    /**
+     * \brief Finish the Schedule and Print the Timing and Queueing Delay Statistics
+     */
+    void dumpStats();
+};
+
+#endif
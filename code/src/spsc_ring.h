@@ -0,0 +1,261 @@
+/**
+ * \file spsc_ring.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Lock Free Single Producer Single Consumer Ring Buffer
+ */
+
+#ifndef __SPSC_RING_H__
+#define __SPSC_RING_H__
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+/** Host Cache Line Size Used to Keep Producer and Consumer State Apart */
+#ifndef HOST_CACHE_LINE
+#define HOST_CACHE_LINE 64
+#endif
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/**
+ * \class spscRing
+ * \brief Bounded Ring Passing Plain Old Data from One Producer to One Consumer
+ *
+ * The producer only writes tail and the consumer only writes head, each on
+ * its own host cache line together with that side's cached copy of the
+ * other index, so the two threads exchange lines only when a cached index
+ * runs out. Every time a side has to wait (ring full or ring empty) its
+ * stall counter is bumped, which shows which stage is the bottleneck.
+ */
+template <class T>
+class spscRing
+{
+protected:
+    T *buffer;                  /**< Slots, Aligned to a Host Cache Line */
+    ulong mask;                 /**< Capacity Minus One, Capacity is a Power of Two */
+
+    alignas(HOST_CACHE_LINE) std::atomic<ulong> head;  /**< Next Slot to Read, Written by the Consumer */
+    ulong cachedTail;           /**< Consumer's Last Seen tail */
+    ulong consumerStalls;       /**< Times the Consumer Found the Ring Empty and Waited */
+    ulong consumerWaits;        /**< Yields Spent Waiting by the Consumer */
+
+    alignas(HOST_CACHE_LINE) std::atomic<ulong> tail;  /**< Next Slot to Write, Written by the Producer */
+    ulong cachedHead;           /**< Producer's Last Seen head */
+    ulong producerStalls;       /**< Times the Producer Found the Ring Full and Waited */
+    ulong producerWaits;        /**< Yields Spent Waiting by the Producer */
+
+    alignas(HOST_CACHE_LINE) std::atomic<bool> closed; /**< Producer Will Push No More */
+
+public:
+
+    /**
+     * \brief spscRing Class Constructor
+     * \param[in] capacity Minimum Number of Slots, Rounded Up to a Power of Two
+     */
+    spscRing(ulong capacity)
+    {
+        ulong slots = 1;
+        while(slots < capacity)
+        {
+            slots <<= 1;
+        }
+        size_t bytes = ((slots*sizeof(T) + HOST_CACHE_LINE - 1)/HOST_CACHE_LINE)*HOST_CACHE_LINE;
+        buffer = (T *)aligned_alloc(HOST_CACHE_LINE, bytes);
+        mask = slots - 1;
+
+        head = 0;
+        tail = 0;
+        cachedHead = cachedTail = 0;
+        consumerStalls = consumerWaits = 0;
+        producerStalls = producerWaits = 0;
+        closed = false;
+    }
+
+    /**
+     * \brief spscRing Class Destructor
+     */
+    ~spscRing()
+    {
+        free(buffer);
+    }
+
+    /**
+     * \brief Producer: Push as Many Items as Fit Without Waiting
+     * \param[in] items Items to Push
+     * \param[in] n Number of Items
+     * \return Number of Items Pushed
+     */
+    ulong push(const T *items, ulong n)
+    {
+        ulong t = tail.load(std::memory_order_relaxed);
+        ulong room = (mask + 1) - (t - cachedHead);
+        if(room < n)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            room = (mask + 1) - (t - cachedHead);
+        }
+        if(n > room)
+        {
+            n = room;
+        }
+
+        /** Copy in at Most Two Runs, Before and After the Wrap */
+        ulong first = (mask + 1) - (t & mask);
+        if(first > n)
+        {
+            first = n;
+        }
+        memcpy(&buffer[t & mask], items, first*sizeof(T));
+        memcpy(&buffer[0], items + first, (n - first)*sizeof(T));
+
+        tail.store(t + n, std::memory_order_release);
+
+        return n;
+    }
+
+    /**
+     * \brief Producer: Push All Items, Waiting While the Ring is Full
+     * \param[in] items Items to Push
+     * \param[in] n Number of Items
+     */
+    void pushAll(const T *items, ulong n)
+    {
+        while(n > 0)
+        {
+            ulong pushed = push(items, n);
+            if(pushed == 0)
+            {
+                producerStalls++;
+                do
+                {
+                    producerWaits++;
+                    std::this_thread::yield();
+                    pushed = push(items, n);
+                } while(pushed == 0);
+            }
+            items += pushed;
+            n -= pushed;
+        }
+    }
+
+    /**
+     * \brief Producer: Signal that Nothing More will be Pushed
+     */
+    void close()
+    {
+        closed.store(true, std::memory_order_release);
+    }
+
+    /**
+     * \brief Consumer: Pop Whatever is Available Without Waiting
+     * \param[out] items Buffer for the Popped Items
+     * \param[in] max Capacity of the Buffer
+     * \return Number of Items Popped
+     */
+    ulong pop(T *items, ulong max)
+    {
+        ulong h = head.load(std::memory_order_relaxed);
+        ulong avail = cachedTail - h;
+        if(avail < max)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            avail = cachedTail - h;
+        }
+        if(avail > max)
+        {
+            avail = max;
+        }
+
+        ulong first = (mask + 1) - (h & mask);
+        if(first > avail)
+        {
+            first = avail;
+        }
+        memcpy(items, &buffer[h & mask], first*sizeof(T));
+        memcpy(items + first, &buffer[0], (avail - first)*sizeof(T));
+
+        head.store(h + avail, std::memory_order_release);
+
+        return avail;
+    }
+
+    /**
+     * \brief Consumer: Pop at Least One Item, Waiting While the Ring is Empty
+     * \param[out] items Buffer for the Popped Items
+     * \param[in] max Capacity of the Buffer
+     * \return Number of Items Popped, 0 Once the Ring is Closed and Drained
+     */
+    ulong popWait(T *items, ulong max)
+    {
+        ulong n = pop(items, max);
+        if(n > 0)
+        {
+            return n;
+        }
+
+        consumerStalls++;
+        while(true)
+        {
+            /** Check closed Before Popping so Items Pushed Before close() are Not Lost */
+            bool done = closed.load(std::memory_order_acquire);
+            n = pop(items, max);
+            if((n > 0) || done)
+            {
+                return n;
+            }
+            consumerWaits++;
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * \brief Get Producer Stall Counter
+     * \return Times the Producer Waited on a Full Ring
+     */
+    ulong getProducerStalls()
+    {
+        return producerStalls;
+    }
+
+    /**
+     * \brief Get Producer Wait Counter
+     * \return Yields Spent by the Producer Waiting on a Full Ring
+     */
+    ulong getProducerWaits()
+    {
+        return producerWaits;
+    }
+
+    /**
+     * \brief Get Consumer Stall Counter
+     * \return Times the Consumer Waited on an Empty Ring
+     */
+    ulong getConsumerStalls()
+    {
+        return consumerStalls;
+    }
+
+    /**
+     * \brief Get Consumer Wait Counter
+     * \return Yields Spent by the Consumer Waiting on an Empty Ring
+     */
+    ulong getConsumerWaits()
+    {
+        return consumerWaits;
+    }
+
+    /**
+     * \brief Get Ring Capacity
+     * \return Number of Slots
+     */
+    ulong getCapacity()
+    {
+        return mask + 1;
+    }
+};
+
+#endif
@@ -0,0 +1,343 @@
+/**
+ * \file sweep.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Single Pass Multi Configuration Sweep
+ */
+
+#include "sweep.h"
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+
+using namespace std;
+
+/**
+ * \struct sweepJob
+ * \brief Work Shared by the Threads of a Parallel Sweep
+ */
+struct sweepJob
+{
+    const vector<sweepConfig> *configs;         /**< Configurations to Simulate */
+    const vector<traceRecord> *records;         /**< Decoded Trace, Read Only */
+    vector<coherenceController *> *ctrls;       /**< Finished Controller per Configuration */
+    atomic<ulong> nextConfig;                   /**< Next Configuration to Hand Out */
+    trafficParams traffic;                      /**< Bytes Charged to Bus Transactions */
+};
+
+/**
+ * \brief Power of Two Check
+ * \param[in] v Value to Check
+ * \return Whether v is a Positive Power of Two
+ */
+static bool isPow2(long v)
+{
+    return (v > 0) && ((v & (v - 1)) == 0);
+}
+
+bool loadSweepConfigs(const char *fname, vector<sweepConfig> &configs, enum replKind repl)
+{
+    FILE *pFile = fopen(fname, "r");
+    if(pFile == 0)
+    {
+        printf("Sweep configuration file problem\n");
+        return false;
+    }
+
+    char line[256];
+    int lineNum = 0;
+    bool ok = true;
+
+    while(ok && (fgets(line, sizeof(line), pFile) != NULL))
+    {
+        lineNum++;
+
+        char first = ' ';
+        if(sscanf(line, " %c", &first) != 1 || first == '#')
+        {
+            continue;
+        }
+
+        sweepConfig config;
+        int protocol;
+        char policy[32];
+        int fields = sscanf(line, "%d %d %d %d %d %31s", &config.cacheSize, &config.assoc, &config.blkSize, &config.numProcessors, &protocol, policy);
+        config.repl = repl;
+        if(fields < 5)
+        {
+            ok = false;
+        }
+        else if((fields == 6) && (policy[0] != '#') && !parseReplPolicy(policy, config.repl))
+        {
+            ok = false;
+        }
+        else if((config.repl == REPL_TREE_PLRU) && !isPow2(config.assoc))
+        {
+            ok = false;
+        }
+        else if(!isPow2(config.blkSize) || !isPow2(config.assoc) || (config.numProcessors < 1) || (protocol < 0) || (protocol >= NUM_COH_PROTOCOLS))
+        {
+            ok = false;
+        }
+        else if((config.cacheSize % (config.blkSize*config.assoc) != 0) || !isPow2(config.cacheSize/(config.blkSize*config.assoc)))
+        {
+            ok = false;
+        }
+
+        if(!ok)
+        {
+            printf("Sweep configuration file problem: bad configuration on line %d\n", lineNum);
+            break;
+        }
+
+        config.protocol = (enum coh_protocol)protocol;
+        configs.push_back(config);
+    }
+    fclose(pFile);
+
+    return ok;
+}
+
+void printSweepHeader()
+{
+    printf("size, assoc, block_size, processors, protocol, replacement, reads, read_misses, writes, write_misses, miss_rate, writebacks, cache2cache, mem_transactions, interventions, invalidations, flushes, busrdx, control_bytes, data_bytes, bytes_per_ref\n");
+}
+
+void printSweepRow(const sweepConfig &config, coherenceController *ctrl)
+{
+    ulong reads = 0, readMisses = 0, writes = 0, writeMisses = 0, writeBacks = 0;
+    ulong cache2cache = 0, memTransactions = 0, interv = 0, inval = 0, flush = 0, busrdx = 0;
+    ulong ctrlBytes = 0, dataBytes = 0;
+    int loop_i;
+
+    for(loop_i=0; loop_i<ctrl->getNumProcessors(); loop_i++)
+    {
+        Cache *cache = ctrl->getCache(loop_i);
+        reads += cache->getReads();
+        readMisses += cache->getRM();
+        writes += cache->getWrites();
+        writeMisses += cache->getWM();
+        writeBacks += cache->getWB();
+        cache2cache += cache->getCache2cache();
+        memTransactions += cache->getMemtransactions();
+        interv += cache->getInterv();
+        inval += cache->getInval();
+        flush += cache->getFlush();
+        busrdx += cache->getBusrdx();
+        ctrlBytes += cache->getCtrlBytes();
+        dataBytes += cache->getDataBytes();
+    }
+
+    float missRate = ((float)(readMisses+writeMisses))*100.0/((float)(reads+writes));
+
+    printf("%d, %d, %d, %d, %s, %s, %lu, %lu, %lu, %lu, %.2f, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %.2f\n",
+           config.cacheSize, config.assoc, config.blkSize, config.numProcessors, getProtocolName(config.protocol), getReplPolicyName(config.repl),
+           reads, readMisses, writes, writeMisses, missRate, writeBacks,
+           cache2cache, memTransactions, interv, inval, flush, busrdx,
+           ctrlBytes, dataBytes, (reads + writes) ? (double)(ctrlBytes + dataBytes)/(reads + writes) : 0.0);
+}
+
+/**
+ * \brief Get the Smallest Processor Count of a Sweep
+ * \param[in] configs Configurations of the Sweep
+ * \return Smallest numProcessors, 0 for an Empty Sweep
+ */
+static int getMinProcessors(const vector<sweepConfig> &configs)
+{
+    int minProcessors = 0;
+    ulong loop_c;
+
+    for(loop_c=0; loop_c<configs.size(); loop_c++)
+    {
+        if((loop_c == 0) || (configs[loop_c].numProcessors < minProcessors))
+        {
+            minProcessors = configs[loop_c].numProcessors;
+        }
+    }
+
+    return minProcessors;
+}
+
+/**
+ * \brief Check Every Record Names a Processor All Configurations Have
+ * \param[in] batch Decoded Trace Records
+ * \param[in] numRecords Number of Records
+ * \param[in] minProcessors Smallest Processor Count of the Sweep
+ * \return Whether Every Processor Number is in Range
+ */
+static bool checkProcessors(const traceRecord *batch, ulong numRecords, int minProcessors)
+{
+    ulong loop_r;
+
+    for(loop_r=0; loop_r<numRecords; loop_r++)
+    {
+        if(batch[loop_r].procNum >= (uint)minProcessors)
+        {
+            printf("Trace file problem: processor %u out of range\n", batch[loop_r].procNum);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Print the Header and Every Row of a Finished Sweep, Then Free the Controllers
+ *
+ * The CSV format has per cache columns, so its header is printed again
+ * whenever the processor count changes.
+ *
+ * \param[in] configs Configurations of the Sweep
+ * \param[in] ctrls Controller per Configuration
+ * \param[in] print Whether to Print the Results
+ * \param[in] format Result Format
+ * \param[in] traceName Trace File Name
+ */
+static void finishSweep(const vector<sweepConfig> &configs, vector<coherenceController *> &ctrls, bool print, enum outputFormat format, const char *traceName)
+{
+    ulong loop_c;
+
+    if(print && (format == FORMAT_TEXT))
+    {
+        printSweepHeader();
+        for(loop_c=0; loop_c<ctrls.size(); loop_c++)
+        {
+            printSweepRow(configs[loop_c], ctrls[loop_c]);
+        }
+    }
+    else if(print)
+    {
+        for(loop_c=0; loop_c<ctrls.size(); loop_c++)
+        {
+            if((format == FORMAT_CSV) && ((loop_c == 0) || (configs[loop_c].numProcessors != configs[loop_c - 1].numProcessors)))
+            {
+                printCsvHeader(configs[loop_c].numProcessors);
+            }
+            printRecord(format, configs[loop_c], traceName, ctrls[loop_c]);
+        }
+    }
+
+    for(loop_c=0; loop_c<ctrls.size(); loop_c++)
+    {
+        delete ctrls[loop_c];
+    }
+}
+
+/**
+ * \brief Parallel Sweep Worker, Simulates Configurations Until None are Left
+ * \param[in] job Work Shared by All Workers
+ */
+static void sweepWorker(sweepJob *job)
+{
+    ulong loop_c;
+
+    while((loop_c = job->nextConfig++) < job->configs->size())
+    {
+        const sweepConfig &config = (*job->configs)[loop_c];
+        coherenceController *ctrl = createController(config.cacheSize, config.assoc, config.blkSize, config.numProcessors, config.protocol, config.repl);
+        ctrl->setTraffic(job->traffic);
+
+        if(!job->records->empty())
+        {
+            ctrl->processBatch(&(*job->records)[0], job->records->size());
+        }
+
+        /** Each Worker Writes Only the Slot of its Own Configuration */
+        (*job->ctrls)[loop_c] = ctrl;
+    }
+}
+
+int runSweep(const vector<sweepConfig> &configs, traceReader &trace, const trafficParams &traffic, enum outputFormat format, const char *traceName)
+{
+    vector<coherenceController *> ctrls;
+    int minProcessors = getMinProcessors(configs);
+    ulong loop_c;
+
+    for(loop_c=0; loop_c<configs.size(); loop_c++)
+    {
+        const sweepConfig &config = configs[loop_c];
+        ctrls.push_back(createController(config.cacheSize, config.assoc, config.blkSize, config.numProcessors, config.protocol, config.repl));
+        ctrls.back()->setTraffic(traffic);
+    }
+
+    /** Every Controller Consumes the Same Decoded Batch Before the Next is Decoded */
+    static traceRecord batch[TRACE_BATCH];
+    ulong numRecords;
+    int rc = 0;
+
+    while((rc == 0) && ((numRecords = trace.nextBatch(batch, TRACE_BATCH)) > 0))
+    {
+        if(!checkProcessors(batch, numRecords, minProcessors))
+        {
+            rc = 1;
+        }
+
+        for(loop_c=0; (rc == 0) && (loop_c<ctrls.size()); loop_c++)
+        {
+            ctrls[loop_c]->processBatch(batch, numRecords);
+        }
+    }
+
+    if(trace.hasError())
+    {
+        printf("Trace file problem\n");
+        rc = 1;
+    }
+
+    finishSweep(configs, ctrls, rc == 0, format, traceName);
+
+    return rc;
+}
+
+int runParallelSweep(const vector<sweepConfig> &configs, traceReader &trace, int numThreads, const trafficParams &traffic, enum outputFormat format, const char *traceName)
+{
+    vector<traceRecord> records;
+
+    /** Decode Once, Every Worker Reads the Same Buffer */
+    if(!trace.readAll(records))
+    {
+        printf("Trace file problem\n");
+        return 1;
+    }
+    if(records.size() && !checkProcessors(&records[0], records.size(), getMinProcessors(configs)))
+    {
+        return 1;
+    }
+
+    if(numThreads <= 0)
+    {
+        numThreads = (int)thread::hardware_concurrency();
+    }
+    if((ulong)numThreads > configs.size())
+    {
+        numThreads = (int)configs.size();
+    }
+    if(numThreads < 1)
+    {
+        numThreads = 1;
+    }
+
+    vector<coherenceController *> ctrls(configs.size(), (coherenceController *)NULL);
+    sweepJob job;
+    job.configs = &configs;
+    job.records = &records;
+    job.ctrls = &ctrls;
+    job.nextConfig = 0;
+    job.traffic = traffic;
+
+    vector<thread> pool;
+    int loop_t;
+    for(loop_t=0; loop_t<numThreads; loop_t++)
+    {
+        pool.push_back(thread(sweepWorker, &job));
+    }
+    for(loop_t=0; loop_t<numThreads; loop_t++)
+    {
+        pool[loop_t].join();
+    }
+
+    /** Rows Come Out in Configuration Order Whatever Order the Workers Finished In */
+    finishSweep(configs, ctrls, true, format, traceName);
+
+    return 0;
+}
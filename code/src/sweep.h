@@ -0,0 +1,87 @@
+/**
+ * \file sweep.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Single Pass Multi Configuration Sweep
+ */
+
+#ifndef __SWEEP_H__
+#define __SWEEP_H__
+
+#include <vector>
+
+#include "coherence_ctrl.h"
+#include "trace_reader.h"
+#include "metrics_output.h"
+
+/**
+ * \struct sweepConfig
+ * \brief One Simulated System Configuration of a Sweep
+ */
+struct sweepConfig
+{
+    int cacheSize;                      /**< Cache Size */
+    int assoc;                          /**< Cache Associativity */
+    int blkSize;                        /**< Cache Block Size */
+    int numProcessors;                  /**< Number of Processors */
+    enum coh_protocol protocol;         /**< Coherence Protocol */
+    enum replKind repl;                 /**< Replacement Policy */
+};
+
+/**
+ * \brief Load Sweep Configurations
+ *
+ * Each non blank line not starting with '#' holds
+ * "<cache_size> <assoc> <block_size> <num_processors> <protocol> [policy]",
+ * with the same meaning as the simulator's command line arguments and the
+ * --repl option.
+ *
+ * \param[in] fname Configuration File Name
+ * \param[out] configs Loaded Configurations, in File Order
+ * \param[in] repl Replacement Policy of Lines Not Naming One
+ * \return Whether the File was Read and Every Line was Valid
+ */
+bool loadSweepConfigs(const char *fname, std::vector<sweepConfig> &configs, enum replKind repl);
+
+/**
+ * \brief Print the Column Names of the Sweep Result Rows
+ */
+void printSweepHeader();
+
+/**
+ * \brief Print One Sweep Result Row, Counters Summed over All Caches
+ * \param[in] config Configuration that was Simulated
+ * \param[in] ctrl Coherence Controller that Simulated it
+ */
+void printSweepRow(const sweepConfig &config, coherenceController *ctrl);
+
+/**
+ * \brief Simulate Every Configuration from One Pass over the Trace
+ * \param[in] configs Configurations to Simulate
+ * \param[in] trace Opened Trace
+ * \param[in] traffic Bytes Charged to Bus Transactions
+ * \param[in] format Result Format, FORMAT_TEXT for the Sweep Rows
+ * \param[in] traceName Trace File Name, Recorded by the Other Formats
+ * \return 0 on Success, Non Zero if the Trace is Malformed
+ */
+int runSweep(const std::vector<sweepConfig> &configs, traceReader &trace, const trafficParams &traffic, enum outputFormat format, const char *traceName);
+
+/**
+ * \brief Simulate Every Configuration on a Pool of Threads
+ *
+ * The trace is decoded once into a shared read only buffer, then each
+ * worker repeatedly takes the next unsimulated configuration and runs its
+ * own coherenceController over the whole buffer. Rows are printed in
+ * configuration order.
+ *
+ * \param[in] configs Configurations to Simulate
+ * \param[in] trace Opened Trace
+ * \param[in] numThreads Number of Worker Threads, 0 for One per Hardware Thread
+ * \param[in] traffic Bytes Charged to Bus Transactions
+ * \param[in] format Result Format, FORMAT_TEXT for the Sweep Rows
+ * \param[in] traceName Trace File Name, Recorded by the Other Formats
+ * \return 0 on Success, Non Zero if the Trace is Malformed
+ */
+int runParallelSweep(const std::vector<sweepConfig> &configs, traceReader &trace, int numThreads, const trafficParams &traffic, enum outputFormat format, const char *traceName);
+
+#endif
@@ -0,0 +1,306 @@
+/**
+ * \file tag_match.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Set Associative Tag Search and Scan Kernels (Scalar, SSE4.1, AVX2)
+ *
+ * The vector kernels are compiled with per function target attributes and
+ * picked at run time, so the simulator binary still runs on any x86-64
+ * host and on other architectures, where only the scalar kernel exists.
+ */
+
+#include "tag_match.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define TAG_MATCH_X86 1
+#include <immintrin.h>
+#endif
+
+int matchTagScalar(const ulong *lines, ulong assoc, ulong key)
+{
+    ulong j;
+
+    for(j=0; j<assoc; j++)
+    {
+        if((lines[j] & LINE_TAG_BITS) == key)
+        {
+            return (int)j;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * \brief Scan Line Words One at a Time, from a Given Slot to the End
+ * \param[in] lines Contiguous Packed Line Words
+ * \param[in] first First Slot to Scan
+ * \param[in] count Number of Lines
+ * \param[in] key lineKey of the Tag to Look For
+ * \param[in] assoc Ways per Group
+ * \param[in,out] holders Bit per Group, 64 per Word
+ */
+static inline void scanTagsFrom(const ulong *lines, ulong first, ulong count, ulong key, ulong assoc, ulong *holders)
+{
+    ulong j;
+
+    for(j=first; j<count; j++)
+    {
+        if((lines[j] & LINE_TAG_BITS) == key)
+        {
+            holders[(j/assoc)/64] |= 1UL << ((j/assoc) % 64);
+        }
+    }
+}
+
+void scanTagsScalar(const ulong *lines, ulong count, ulong key, ulong assoc, ulong *holders)
+{
+    scanTagsFrom(lines, 0, count, key, assoc, holders);
+}
+
+/**
+ * \brief Record the Groups of the Slots Set in a Compare Mask
+ * \param[in] first Slot of Bit 0 of the Mask
+ * \param[in] mask Matching Slots
+ * \param[in] assoc Ways per Group
+ * \param[in,out] holders Bit per Group, 64 per Word
+ */
+static inline void recordMatches(ulong first, int mask, ulong assoc, ulong *holders)
+{
+    while(mask != 0)
+    {
+        ulong group = (first + __builtin_ctz(mask))/assoc;
+        holders[group/64] |= 1UL << (group % 64);
+        mask &= mask - 1;
+    }
+}
+
+#ifdef TAG_MATCH_X86
+
+/**
+ * \brief SSE4.1 Compare of Two Line Words' Tag Bits
+ * \param[in] lines First of Two Packed Line Words
+ * \param[in] key lineKey in Both Lanes
+ * \param[in] tagBits LINE_TAG_BITS in Both Lanes
+ * \return Bit per Matching Line
+ */
+__attribute__((target("sse4.1")))
+static inline int compareSSE41(const ulong *lines, __m128i key, __m128i tagBits)
+{
+    __m128i words = _mm_and_si128(_mm_loadu_si128((const __m128i *)lines), tagBits);
+    return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(words, key)));
+}
+
+/**
+ * \brief AVX2 Compare of Four Line Words' Tag Bits
+ * \param[in] lines First of Four Packed Line Words
+ * \param[in] key lineKey in Every Lane
+ * \param[in] tagBits LINE_TAG_BITS in Every Lane
+ * \return Bit per Matching Line
+ */
+__attribute__((target("avx2")))
+static inline int compareAVX2(const ulong *lines, __m256i key, __m256i tagBits)
+{
+    __m256i words = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)lines), tagBits);
+    return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(words, key)));
+}
+
+/**
+ * \brief SSE4.1 Tag Search, Two Ways per Compare
+ * \param[in] lines Contiguous Packed Line Words of the Ways of One Set
+ * \param[in] assoc Number of Ways, Even
+ * \param[in] key lineKey of the Tag to Look For
+ * \return Way Whose Tag Bits Equal the Key, -1 if None Do
+ */
+__attribute__((target("sse4.1")))
+static int matchTagSSE41(const ulong *lines, ulong assoc, ulong key)
+{
+    const __m128i keys = _mm_set1_epi64x((long long)key);
+    const __m128i tagBits = _mm_set1_epi64x((long long)LINE_TAG_BITS);
+    ulong j;
+
+    for(j=0; j<assoc; j+=2)
+    {
+        int mask = compareSSE41(&lines[j], keys, tagBits);
+        if(mask)
+        {
+            return (int)j + __builtin_ctz(mask);
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * \brief AVX2 Tag Search, Four Ways per Compare
+ *
+ * Eight ways are compared per step when the set has them, with the two
+ * masks merged so the loop takes a single branch per host cache line.
+ *
+ * \param[in] lines Contiguous Packed Line Words of the Ways of One Set
+ * \param[in] assoc Number of Ways, a Multiple of 4
+ * \param[in] key lineKey of the Tag to Look For
+ * \return Way Whose Tag Bits Equal the Key, -1 if None Do
+ */
+__attribute__((target("avx2")))
+static int matchTagAVX2(const ulong *lines, ulong assoc, ulong key)
+{
+    const __m256i keys = _mm256_set1_epi64x((long long)key);
+    const __m256i tagBits = _mm256_set1_epi64x((long long)LINE_TAG_BITS);
+    ulong j = 0;
+
+    for(; j+8<=assoc; j+=8)
+    {
+        int mask = compareAVX2(&lines[j], keys, tagBits) | (compareAVX2(&lines[j+4], keys, tagBits) << 4);
+        if(mask)
+        {
+            return (int)j + __builtin_ctz(mask);
+        }
+    }
+    if(j < assoc)
+    {
+        int mask = compareAVX2(&lines[j], keys, tagBits);
+        if(mask)
+        {
+            return (int)j + __builtin_ctz(mask);
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * \brief SSE4.1 Tag Scan, Two Lines per Compare
+ * \param[in] lines Contiguous Packed Line Words
+ * \param[in] count Number of Lines
+ * \param[in] key lineKey of the Tag to Look For
+ * \param[in] assoc Ways per Group
+ * \param[in,out] holders Bit per Group, 64 per Word
+ */
+__attribute__((target("sse4.1")))
+static void scanTagsSSE41(const ulong *lines, ulong count, ulong key, ulong assoc, ulong *holders)
+{
+    const __m128i keys = _mm_set1_epi64x((long long)key);
+    const __m128i tagBits = _mm_set1_epi64x((long long)LINE_TAG_BITS);
+    ulong j = 0;
+
+    for(; j+2<=count; j+=2)
+    {
+        int mask = compareSSE41(&lines[j], keys, tagBits);
+        if(mask)
+        {
+            recordMatches(j, mask, assoc, holders);
+        }
+    }
+    scanTagsFrom(lines, j, count, key, assoc, holders);
+}
+
+/**
+ * \brief AVX2 Tag Scan, Eight Lines per Branch
+ * \param[in] lines Contiguous Packed Line Words
+ * \param[in] count Number of Lines
+ * \param[in] key lineKey of the Tag to Look For
+ * \param[in] assoc Ways per Group
+ * \param[in,out] holders Bit per Group, 64 per Word
+ */
+__attribute__((target("avx2")))
+static void scanTagsAVX2(const ulong *lines, ulong count, ulong key, ulong assoc, ulong *holders)
+{
+    const __m256i keys = _mm256_set1_epi64x((long long)key);
+    const __m256i tagBits = _mm256_set1_epi64x((long long)LINE_TAG_BITS);
+    ulong j = 0;
+
+    for(; j+8<=count; j+=8)
+    {
+        int mask = compareAVX2(&lines[j], keys, tagBits) | (compareAVX2(&lines[j+4], keys, tagBits) << 4);
+        if(mask)
+        {
+            recordMatches(j, mask, assoc, holders);
+        }
+    }
+    scanTagsFrom(lines, j, count, key, assoc, holders);
+}
+
+#endif
+
+bool tagMatchSupported(enum tagMatchKind kind, ulong assoc)
+{
+    switch(kind)
+    {
+        case TAG_MATCH_SCALAR:  return true;
+#ifdef TAG_MATCH_X86
+        case TAG_MATCH_SSE41:   return ((assoc % 2) == 0) && __builtin_cpu_supports("sse4.1");
+        case TAG_MATCH_AVX2:    return ((assoc % 4) == 0) && __builtin_cpu_supports("avx2");
+#else
+        default:                return false;
+#endif
+    }
+
+    return false;
+}
+
+tagMatchFn getTagMatch(enum tagMatchKind kind)
+{
+    switch(kind)
+    {
+#ifdef TAG_MATCH_X86
+        case TAG_MATCH_SSE41:   return matchTagSSE41;
+        case TAG_MATCH_AVX2:    return matchTagAVX2;
+#endif
+        default:                return matchTagScalar;
+    }
+}
+
+tagScanFn getTagScan(enum tagMatchKind kind)
+{
+    switch(kind)
+    {
+#ifdef TAG_MATCH_X86
+        case TAG_MATCH_SSE41:   return scanTagsSSE41;
+        case TAG_MATCH_AVX2:    return scanTagsAVX2;
+#endif
+        default:                return scanTagsScalar;
+    }
+}
+
+enum tagMatchKind selectTagScan()
+{
+    /** Scans Handle Any Count, Only the Host Decides */
+    if(tagMatchSupported(TAG_MATCH_AVX2, 4))
+    {
+        return TAG_MATCH_AVX2;
+    }
+    if(tagMatchSupported(TAG_MATCH_SSE41, 2))
+    {
+        return TAG_MATCH_SSE41;
+    }
+
+    return TAG_MATCH_SCALAR;
+}
+
+const char *getTagMatchName(enum tagMatchKind kind)
+{
+    switch(kind)
+    {
+        case TAG_MATCH_SCALAR:  return "scalar";
+        case TAG_MATCH_SSE41:   return "sse4.1";
+        case TAG_MATCH_AVX2:    return "avx2";
+    }
+
+    return "UNKNOWN";
+}
+
+enum tagMatchKind selectTagMatch(ulong assoc)
+{
+    /** Two Way Sets Gain Nothing from a Two Lane Compare, and Past 8 Ways its Extra Compares Can Lose to the Early Exit of the Scalar Loop */
+    if(tagMatchSupported(TAG_MATCH_AVX2, assoc))
+    {
+        return TAG_MATCH_AVX2;
+    }
+    if((assoc >= 4) && (assoc <= 8) && tagMatchSupported(TAG_MATCH_SSE41, assoc))
+    {
+        return TAG_MATCH_SSE41;
+    }
+
+    return TAG_MATCH_SCALAR;
+}
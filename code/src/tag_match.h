@@ -0,0 +1,134 @@
+/**
+ * \file tag_match.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Set Associative Tag Search and Scan Kernels (Scalar, SSE4.1, AVX2)
+ */
+
+#ifndef __TAG_MATCH_H__
+#define __TAG_MATCH_H__
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/** Low Bits of a Packed Line Word Holding the Line's State, its Inverted Tag Sits Above Them */
+#define LINE_STATE_BITS 4
+
+/** Bits of a Packed Line Word Holding the Inverted Tag */
+#define LINE_TAG_BITS (~0UL << LINE_STATE_BITS)
+
+/**
+ * \brief Packed Line Word of an Invalid Line, All Zero
+ *
+ * Tags are stored inverted, so the invalid line's all ones tag is stored
+ * as zero and zero filled memory is a set of invalid lines. No block
+ * address maps to the all ones tag unless the address has its top bits
+ * set, so comparing the tag bits alone also checks the line is valid, and
+ * searching for this word finds an invalid way.
+ */
+#define INVALID_LINE 0UL
+
+/**
+ * \brief Get the Search Key of a Tag, the Tag Bits of a Line Word Holding it
+ * \param[in] tag Tag, Below 2^(64-LINE_STATE_BITS)
+ * \return Key Compared Against the Tag Bits of Line Words
+ */
+inline ulong lineKey(ulong tag)
+{
+    return ~tag << LINE_STATE_BITS;
+}
+
+/**
+ * \brief Tag Search Kernel
+ * \param[in] lines Contiguous Packed Line Words of the Ways of One Set
+ * \param[in] assoc Number of Ways
+ * \param[in] key lineKey of the Tag to Look For
+ * \return Way Whose Tag Bits Equal the Key, -1 if None Do
+ */
+typedef int (*tagMatchFn)(const ulong *lines, ulong assoc, ulong key);
+
+/**
+ * \brief Tag Scan Kernel, Finds Every Group of Ways Holding a Tag
+ *
+ * Scans count contiguous line words made of groups of assoc ways, such as
+ * one set of every cache in an interleaved layout, and sets bit slot/assoc
+ * of holders for each slot matching the key. Bits of groups without a
+ * match are left as they were.
+ *
+ * \param[in] lines Contiguous Packed Line Words
+ * \param[in] count Number of Lines, Any Count
+ * \param[in] key lineKey of the Tag to Look For
+ * \param[in] assoc Ways per Group
+ * \param[in,out] holders Bit per Group, 64 per Word
+ */
+typedef void (*tagScanFn)(const ulong *lines, ulong count, ulong key, ulong assoc, ulong *holders);
+
+/** Tag Search Kernel Enumeration */
+enum tagMatchKind   {
+                        TAG_MATCH_SCALAR = 0,   /**< One Way per Compare, Any Host */
+                        TAG_MATCH_SSE41 =  1,   /**< Two Ways per Compare, Even Associativity */
+                        TAG_MATCH_AVX2 =   2    /**< Four Ways per Compare, Associativity a Multiple of 4 */
+};
+
+/**
+ * \brief Scalar Tag Search
+ * \param[in] lines Contiguous Packed Line Words of the Ways of One Set
+ * \param[in] assoc Number of Ways
+ * \param[in] key lineKey of the Tag to Look For
+ * \return Way Whose Tag Bits Equal the Key, -1 if None Do
+ */
+int matchTagScalar(const ulong *lines, ulong assoc, ulong key);
+
+/**
+ * \brief Check Whether a Kernel Runs on this Host for an Associativity
+ * \param[in] kind Kernel
+ * \param[in] assoc Number of Ways
+ * \return Whether getTagMatch(kind) may be Used for Sets of assoc Ways
+ */
+bool tagMatchSupported(enum tagMatchKind kind, ulong assoc);
+
+/**
+ * \brief Get a Tag Search Kernel
+ * \param[in] kind Kernel, Must be tagMatchSupported
+ * \return Kernel Function
+ */
+tagMatchFn getTagMatch(enum tagMatchKind kind);
+
+/**
+ * \brief Get the Printable Name of a Tag Search Kernel
+ * \param[in] kind Kernel
+ * \return Kernel Name
+ */
+const char *getTagMatchName(enum tagMatchKind kind);
+
+/**
+ * \brief Scalar Tag Scan
+ * \param[in] lines Contiguous Packed Line Words
+ * \param[in] count Number of Lines
+ * \param[in] key lineKey of the Tag to Look For
+ * \param[in] assoc Ways per Group
+ * \param[in,out] holders Bit per Group, 64 per Word
+ */
+void scanTagsScalar(const ulong *lines, ulong count, ulong key, ulong assoc, ulong *holders);
+
+/**
+ * \brief Get a Tag Scan Kernel
+ * \param[in] kind Kernel, Must be Supported by the Host, the Associativity Does Not Matter
+ * \return Kernel Function
+ */
+tagScanFn getTagScan(enum tagMatchKind kind);
+
+/**
+ * \brief Pick the Widest Scan Kernel this Host Supports
+ * \return Kernel Kind
+ */
+enum tagMatchKind selectTagScan();
+
+/**
+ * \brief Pick the Widest Kernel this Host Supports for an Associativity
+ * \param[in] assoc Number of Ways
+ * \return Kernel Kind
+ */
+enum tagMatchKind selectTagMatch(ulong assoc);
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * \file timing_model.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Cycle Approximate Timing Model of the Caches, Bus and Memory
+ */
+
+#include "timing_model.h"
+#include "split_bus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool parseTimingParams(const char *text, timingParams &params)
+{
+    uint *fields[] = {&params.hitLatency, &params.busArbLatency, &params.busXferLatency, &params.c2cLatency, &params.memLatency};
+    uint loop_f;
+    const char *p = text;
+
+    for(loop_f=0; (loop_f<sizeof(fields)/sizeof(fields[0])) && (*p != '\0'); loop_f++)
+    {
+        char *end;
+        ulong value = strtoul(p, &end, 10);
+
+        if((end == p) || (value > 1000000))
+        {
+            return false;
+        }
+        *fields[loop_f] = (uint)value;
+
+        if(*end == ',')
+        {
+            end++;
+        }
+        else if(*end != '\0')
+        {
+            return false;
+        }
+        p = end;
+    }
+
+    return (*p == '\0');
+}
+
+bool parseArbPolicy(const char *name, enum arbKind &arb)
+{
+    if(strcmp(name, "rr") == 0)
+    {
+        arb = ARB_ROUND_ROBIN;
+    }
+    else if(strcmp(name, "fixed") == 0)
+    {
+        arb = ARB_FIXED;
+    }
+    else if(strcmp(name, "fcfs") == 0)
+    {
+        arb = ARB_FCFS;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+const char *getArbPolicyName(enum arbKind arb)
+{
+    switch(arb)
+    {
+        case ARB_ROUND_ROBIN:   return "rr";
+        case ARB_FIXED:         return "fixed";
+        case ARB_FCFS:          return "fcfs";
+    }
+
+    return "unknown";
+}
+
+timingModel::timingModel(const timingParams &p, int numP)
+{
+    params = p;
+    numProcessors = numP;
+    clock = new ulong[numP]();
+    accesses = new ulong[numP]();
+    accessCycles = new ulong[numP]();
+    busCycles = new ulong[numP]();
+    waitCycles = new ulong[numP]();
+    busFree = 0;
+}
+
+timingModel::~timingModel()
+{
+    delete [] clock;
+    delete [] accesses;
+    delete [] accessCycles;
+    delete [] busCycles;
+    delete [] waitCycles;
+}
+
+void atomicTiming::access(ulong procNum, bool usesBus, enum timingSource source, bool writeback)
+{
+    ulong start = clock[procNum];
+    ulong now = start + params.hitLatency;
+
+    if(usesBus)
+    {
+        ulong grant = (busFree > now) ? busFree : now;
+        ulong hold = params.busArbLatency + params.busXferLatency;
+
+        if(source == SRC_CACHE)
+        {
+            hold += params.c2cLatency;
+        }
+        else if(source == SRC_MEMORY)
+        {
+            hold += params.memLatency;
+        }
+
+        waitCycles[procNum] += grant - now;
+        busCycles[procNum] += hold;
+        now = grant + hold;
+        busFree = now;
+    }
+
+    if(writeback)
+    {
+        ulong hold = params.busArbLatency + params.busXferLatency;
+        busFree = ((busFree > now) ? busFree : now) + hold;
+        busCycles[procNum] += hold;
+    }
+
+    clock[procNum] = now;
+    accesses[procNum]++;
+    accessCycles[procNum] += now - start;
+}
+
+timingModel *createTimingModel(const timingParams &params, int numP)
+{
+    if(params.bus == BUS_SPLIT)
+    {
+        return new splitTiming(params, numP);
+    }
+
+    return new atomicTiming(params, numP);
+}
+
+void timingModel::dumpStats()
+{
+    ulong elapsed = busFree;
+    ulong totalBus = 0;
+    int loop_i;
+
+    for(loop_i=0; loop_i<numProcessors; loop_i++)
+    {
+        if(clock[loop_i] > elapsed)
+        {
+            elapsed = clock[loop_i];
+        }
+        totalBus += busCycles[loop_i];
+    }
+
+    printf("============ Timing model ============\n");
+    printf("latencies (cycles): hit %u, bus arbitration %u, bus transfer %u, cache-to-cache %u, memory %u\n",
+           params.hitLatency, params.busArbLatency, params.busXferLatency, params.c2cLatency, params.memLatency);
+    if(params.bus == BUS_SPLIT)
+    {
+        printf("bus: split transaction, arbitration %s, %u outstanding\n", getArbPolicyName(params.arb), params.maxOutstanding);
+    }
+    else
+    {
+        printf("bus: atomic\n");
+    }
+    for(loop_i=0; loop_i<numProcessors; loop_i++)
+    {
+        printf("Cache %d: execution cycles %lu\tAMAT %.2f\tbus wait cycles %lu\tbus utilization %.2f%%\n", loop_i,
+               clock[loop_i],
+               accesses[loop_i] ? (double)accessCycles[loop_i]/accesses[loop_i] : 0.0,
+               waitCycles[loop_i],
+               elapsed ? (double)busCycles[loop_i]*100.0/elapsed : 0.0);
+    }
+    printf("estimated execution cycles:     \t%lu\n", elapsed);
+    printf("total bus utilization:          \t%.2f%%\n", elapsed ? (double)totalBus*100.0/elapsed : 0.0);
+}
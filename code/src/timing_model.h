@@ -0,0 +1,179 @@
+/**
+ * \file timing_model.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Cycle Approximate Timing Model of the Caches, Bus and Memory
+ */
+
+#ifndef __TIMING_MODEL_H__
+#define __TIMING_MODEL_H__
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/** Type define unsigned char as uchar */
+typedef unsigned char uchar;
+
+/** Type define unsigned int as uint */
+typedef unsigned int uint;
+
+/** Bus Model Enumeration */
+enum busKind    {
+                    BUS_ATOMIC =    0,  /**< One Transaction Holds the Bus Until its Data Arrives */
+                    BUS_SPLIT =     1   /**< Request and Response Phases, the Bus is Free in Between */
+};
+
+/** Bus Arbitration Policy Enumeration, Used by the Split Transaction Bus */
+enum arbKind    {
+                    ARB_ROUND_ROBIN =   0,  /**< Rotate Priority Past the Last Processor Granted */
+                    ARB_FIXED =         1,  /**< Lowest Numbered Processor First */
+                    ARB_FCFS =          2   /**< Longest Waiting Request First */
+};
+
+/**
+ * \struct timingParams
+ * \brief Latencies in Cycles and Bus Organization
+ */
+struct timingParams
+{
+    uint hitLatency;            /**< Cache Lookup, Paid by Every Access */
+    uint busArbLatency;         /**< Bus Arbitration */
+    uint busXferLatency;        /**< Address and Command, or Block, Transfer on the Bus */
+    uint c2cLatency;            /**< Another Cache Supplying the Block */
+    uint memLatency;            /**< Memory Supplying the Block */
+    enum busKind bus;           /**< Bus Model */
+    enum arbKind arb;           /**< Arbitration Policy of the Split Transaction Bus */
+    uint maxOutstanding;        /**< Split Transactions Between Request and Response at Once */
+
+    /**
+     * \brief timingParams Constructor, Default Latencies
+     */
+    timingParams()
+    {
+        hitLatency = 1;
+        busArbLatency = 2;
+        busXferLatency = 8;
+        c2cLatency = 20;
+        memLatency = 100;
+        bus = BUS_ATOMIC;
+        arb = ARB_ROUND_ROBIN;
+        maxOutstanding = 4;
+    }
+};
+
+/**
+ * \brief Parse "hit,arb,xfer,c2c,mem" Latencies, Missing Trailing Fields Keep their Value
+ * \param[in] text Comma Separated Latencies in Cycles
+ * \param[in,out] params Latencies
+ * \return Whether the Text was Valid
+ */
+bool parseTimingParams(const char *text, timingParams &params);
+
+/**
+ * \brief Parse a Bus Arbitration Policy Name
+ * \param[in] name "rr", "fixed" or "fcfs"
+ * \param[out] arb Parsed Policy
+ * \return Whether the Name is Known
+ */
+bool parseArbPolicy(const char *name, enum arbKind &arb);
+
+/**
+ * \brief Get the Printable Name of a Bus Arbitration Policy
+ * \param[in] arb Policy
+ * \return Policy Name as Given to --arb
+ */
+const char *getArbPolicyName(enum arbKind arb);
+
+/** Data Source of a Bus Transaction */
+enum timingSource   {
+                        SRC_NONE =      0,  /**< No Data Moves, an Upgrade or Update */
+                        SRC_CACHE =     1,  /**< Another Cache Supplies the Block */
+                        SRC_MEMORY =    2   /**< Memory Supplies the Block */
+};
+
+/**
+ * \class timingModel
+ * \brief Base Class Keeping a Cycle Clock and Bus Statistics per Processor
+ */
+class timingModel
+{
+protected:
+    timingParams params;        /**< Latencies */
+    int numProcessors;          /**< Number of Processors */
+    ulong *clock;               /**< Cycle Clock per Processor */
+    ulong *accesses;            /**< Accesses per Processor */
+    ulong *accessCycles;        /**< Sum of Access Latencies per Processor */
+    ulong *busCycles;           /**< Cycles of Bus Occupancy Caused per Processor */
+    ulong *waitCycles;          /**< Cycles Spent Waiting for the Bus per Processor */
+    ulong busFree;              /**< Cycle the Bus Becomes Free */
+
+public:
+
+    /**
+     * \brief timingModel Class Constructor
+     * \param[in] p Latencies
+     * \param[in] numP Number of Processors
+     */
+    timingModel(const timingParams &p, int numP);
+
+    /**
+     * \brief timingModel Class Destructor
+     */
+    virtual ~timingModel();
+
+    /**
+     * \brief Time One Access
+     * \param[in] procNum Processor Making the Access
+     * \param[in] usesBus Whether the Access Placed a Command on the Bus
+     * \param[in] source Data Source of the Bus Transaction
+     * \param[in] writeback Whether a Dirty Victim was Written Back
+     */
+    virtual void access(ulong procNum, bool usesBus, enum timingSource source, bool writeback) = 0;
+
+    /**
+     * \brief Print Cycles, Average Memory Access Time and Bus Utilization per Processor
+     */
+    virtual void dumpStats();
+};
+
+/**
+ * \class atomicTiming
+ * \brief Timing Model of an Atomic Bus
+ *
+ * A transaction waits until the bus is free and then holds it for
+ * arbitration, the transfer and the data source's latency. A victim
+ * writeback is posted, it holds the bus for arbitration and one transfer
+ * after the request but does not stall its processor.
+ */
+class atomicTiming : public timingModel
+{
+public:
+
+    /**
+     * \brief atomicTiming Class Constructor
+     * \param[in] p Latencies
+     * \param[in] numP Number of Processors
+     */
+    atomicTiming(const timingParams &p, int numP) : timingModel(p, numP)
+    {
+    }
+
+    /**
+     * \brief Advance the Clocks for One Access
+     * \param[in] procNum Processor Making the Access
+     * \param[in] usesBus Whether the Access Placed a Command on the Bus
+     * \param[in] source Data Source of the Bus Transaction
+     * \param[in] writeback Whether a Dirty Victim was Written Back
+     */
+    void access(ulong procNum, bool usesBus, enum timingSource source, bool writeback);
+};
+
+/**
+ * \brief Create the Timing Model of the Bus Named in the Parameters
+ * \param[in] params Latencies and Bus Organization
+ * \param[in] numP Number of Processors
+ * \return New Timing Model, Owned by the Caller
+ */
+timingModel *createTimingModel(const timingParams &params, int numP);
+
+#endif
@@ -0,0 +1,161 @@
+/**
+ * \file trace_bench.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Trace Decode Throughput Benchmark (fscanf vs Memory Mapped Reader)
+ *
+ * Any converted copies of the trace given after the iteration count are
+ * timed with the same reader and checked against the text trace.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "trace_reader.h"
+
+/**
+ * \brief Wall Clock Time
+ * \return Seconds Since the Epoch
+ */
+static double wallTime()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec*1e-6;
+}
+
+/**
+ * \brief Decode a Trace with fscanf as the Simulator Originally Did
+ * \param[in] fname Trace File Name
+ * \param[out] checksum Checksum of the Decoded Records
+ * \return Number of Records Decoded
+ */
+static ulong benchFscanf(const char *fname, ulong *checksum)
+{
+    FILE *pFile = fopen(fname, "r");
+    if(pFile == 0)
+    {
+        printf("Trace file problem\n");
+        exit(0);
+    }
+
+    char str[16];
+    unsigned long int procNum;
+    unsigned long int procReqAddr;
+    ulong count = 0;
+
+    while(fscanf(pFile, "%lu %15s %lx", &procNum, str, &procReqAddr) != EOF)
+    {
+        *checksum += procNum + (str[0]=='w') + procReqAddr;
+        count++;
+    }
+    fclose(pFile);
+
+    return count;
+}
+
+/**
+ * \brief Decode a Trace with the Memory Mapped Reader
+ * \param[in] fname Trace File Name
+ * \param[out] checksum Checksum of the Decoded Records
+ * \return Number of Records Decoded
+ */
+static ulong benchMmap(const char *fname, ulong *checksum)
+{
+    static traceRecord batch[TRACE_BATCH];
+    traceReader trace;
+    ulong count = 0;
+    ulong numRecords, loop_r;
+
+    if(!trace.open(fname))
+    {
+        printf("Trace file problem\n");
+        exit(0);
+    }
+
+    while((numRecords = trace.nextBatch(batch, TRACE_BATCH)) > 0)
+    {
+        for(loop_r=0; loop_r<numRecords; loop_r++)
+        {
+            *checksum += batch[loop_r].procNum + batch[loop_r].rdWr + batch[loop_r].addr;
+        }
+        count += numRecords;
+    }
+
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+    {
+        printf("input format: ");
+        printf("./trace_bench <trace_file> [iterations] [converted_trace ...] \n");
+        exit(0);
+    }
+
+    const char *fname = argv[1];
+    int iterations = (argc > 2) ? atoi(argv[2]) : 10;
+    if(iterations < 1)
+    {
+        iterations = 1;
+    }
+
+    ulong sumFscanf = 0, sumMmap = 0;
+    ulong recFscanf = 0, recMmap = 0;
+    double start, timeFscanf, timeMmap;
+    int loop_i;
+
+    start = wallTime();
+    for(loop_i=0; loop_i<iterations; loop_i++)
+    {
+        recFscanf += benchFscanf(fname, &sumFscanf);
+    }
+    timeFscanf = wallTime() - start;
+
+    start = wallTime();
+    for(loop_i=0; loop_i<iterations; loop_i++)
+    {
+        recMmap += benchMmap(fname, &sumMmap);
+    }
+    timeMmap = wallTime() - start;
+
+    printf("===== Trace decode benchmark =====\n");
+    printf("TRACE FILE: %s\n", fname);
+    printf("ITERATIONS: %d\n", iterations);
+    printf("fscanf:\t%lu records\t%.3f s\t%.0f records/sec\n", recFscanf, timeFscanf, (double)recFscanf/timeFscanf);
+    printf("mmap:  \t%lu records\t%.3f s\t%.0f records/sec\n", recMmap, timeMmap, (double)recMmap/timeMmap);
+    printf("speedup:\t%.2fx\n", timeFscanf/timeMmap);
+
+    int rc = 0;
+    if((recFscanf != recMmap) || (sumFscanf != sumMmap))
+    {
+        printf("MISMATCH: decoders disagree on the trace contents\n");
+        rc = 1;
+    }
+
+    /** Converted Traces Must Decode to the Same Records as the Text Trace */
+    int loop_f;
+    for(loop_f=3; loop_f<argc; loop_f++)
+    {
+        ulong sumConv = 0, recConv = 0;
+        double timeConv;
+
+        start = wallTime();
+        for(loop_i=0; loop_i<iterations; loop_i++)
+        {
+            recConv += benchMmap(argv[loop_f], &sumConv);
+        }
+        timeConv = wallTime() - start;
+
+        printf("%s:\t%lu records\t%.3f s\t%.0f records/sec\tspeedup vs fscanf %.2fx\n", argv[loop_f], recConv, timeConv, (double)recConv/timeConv, timeFscanf/timeConv);
+        if((recConv != recMmap) || (sumConv != sumMmap))
+        {
+            printf("MISMATCH: %s does not decode to the same records\n", argv[loop_f]);
+            rc = 1;
+        }
+    }
+
+    return rc;
+}
@@ -0,0 +1,216 @@
+/**
+ * \file trace_convert.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Trace Converter (Text to Binary Trace Format)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "trace_reader.h"
+#include "trace_format.h"
+
+using namespace std;
+
+/**
+ * \class deltaEncoder
+ * \brief Class Packing Records into Delta Encoded Blocks
+ */
+class deltaEncoder
+{
+protected:
+    FILE *out;                  /**< Output File */
+    vector<ulong> prevAddr;     /**< Previous Address per Processor in the Current Block */
+    vector<uchar> payload;      /**< Varint Payload of the Current Block */
+    ulong used;                 /**< Bytes of the Payload in Use */
+    uint numRecords;            /**< Records in the Current Block */
+
+public:
+
+    /**
+     * \brief deltaEncoder Class Constructor
+     * \param[in] pFile Output File, Positioned After the File Header
+     */
+    deltaEncoder(FILE *pFile)
+    {
+        out = pFile;
+        payload.resize(TRACE_BLOCK_RECORDS*2*VARINT_MAX_LEN);
+        used = 0;
+        numRecords = 0;
+    }
+
+    /**
+     * \brief Append One Record, Writing Out the Block Once Full
+     * \param[in] rec Record to Encode
+     * \return Whether Every Write Succeeded
+     */
+    bool add(const traceRecord &rec)
+    {
+        if(rec.procNum >= prevAddr.size())
+        {
+            prevAddr.resize(rec.procNum + 1, 0);
+        }
+
+        uchar *p = &payload[used];
+        p = putVarint(p, ((ulong)rec.procNum << 1) | (rec.rdWr & 1));
+        p = putVarint(p, zigzagEncode((long)(rec.addr - prevAddr[rec.procNum])));
+        prevAddr[rec.procNum] = rec.addr;
+        used = p - &payload[0];
+        numRecords++;
+
+        if(numRecords == TRACE_BLOCK_RECORDS)
+        {
+            return flush();
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief Write Out the Current Block, if Any
+     * \return Whether Every Write Succeeded
+     */
+    bool flush()
+    {
+        if(numRecords == 0)
+        {
+            return true;
+        }
+
+        traceBlockHeader block;
+        block.numRecords = numRecords;
+        block.payloadBytes = (uint)used;
+
+        bool ok = (fwrite(&block, sizeof(block), 1, out) == 1);
+        ok = ok && (fwrite(&payload[0], 1, used, out) == used);
+
+        /** Deltas Restart From Zero so Every Block Decodes on its Own */
+        prevAddr.assign(prevAddr.size(), 0);
+        used = 0;
+        numRecords = 0;
+
+        return ok;
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    int argBase = 1;
+    uint encoding = TRACE_ENC_FIXED;
+
+    if((argc > 1) && (strcmp(argv[1], "-z") == 0))
+    {
+        encoding = TRACE_ENC_DELTA;
+        argBase++;
+    }
+
+    if(argc < argBase + 2)
+    {
+        printf("input format: ");
+        printf("./trace_convert [-z] <input_trace> <output_trace> \n");
+        printf("  -z: delta/varint compressed encoding instead of fixed width records\n");
+        exit(0);
+    }
+
+    const char *inName = argv[argBase];
+    const char *outName = argv[argBase + 1];
+
+    traceReader trace;
+    if(!trace.open(inName))
+    {
+        printf("Trace file problem\n");
+        exit(0);
+    }
+
+    /** A Converted Trace Must Declare a Processor Count the Reader Accepts */
+    trace.setProcessorLimit(TRACE_MAX_PROCESSORS);
+
+    FILE *pFile = fopen(outName, "wb");
+    if(pFile == 0)
+    {
+        printf("Output file problem\n");
+        exit(0);
+    }
+
+    /** Header is Rewritten Once the Record and Processor Counts are Known */
+    traceFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TRACE_MAGIC, TRACE_MAGIC_LEN);
+    header.version = TRACE_VERSION;
+    header.encoding = encoding;
+    header.recordSize = (encoding == TRACE_ENC_FIXED) ? sizeof(traceRecord) : 0;
+
+    bool ok = (fwrite(&header, sizeof(header), 1, pFile) == 1);
+
+    static traceRecord batch[TRACE_BATCH];
+    static traceRecord packed[TRACE_BATCH];
+    ulong numRecords, loop_r;
+    deltaEncoder delta(pFile);
+
+    /** Padding Bytes are Zeroed so Identical Traces Give Identical Files */
+    memset(packed, 0, sizeof(packed));
+
+    while(ok && ((numRecords = trace.nextBatch(batch, TRACE_BATCH)) > 0))
+    {
+        for(loop_r=0; loop_r<numRecords; loop_r++)
+        {
+            packed[loop_r].addr = batch[loop_r].addr;
+            packed[loop_r].procNum = batch[loop_r].procNum;
+            packed[loop_r].rdWr = batch[loop_r].rdWr;
+
+            if(batch[loop_r].procNum >= header.numProcessors)
+            {
+                header.numProcessors = batch[loop_r].procNum + 1;
+            }
+        }
+        header.numRecords += numRecords;
+
+        if(encoding == TRACE_ENC_DELTA)
+        {
+            for(loop_r=0; ok && (loop_r<numRecords); loop_r++)
+            {
+                ok = delta.add(batch[loop_r]);
+            }
+        }
+        else
+        {
+            ok = (fwrite(packed, sizeof(traceRecord), numRecords, pFile) == numRecords);
+        }
+    }
+    ok = ok && delta.flush();
+
+    if(trace.hasError())
+    {
+        if(trace.getFormat() == TRACE_FILE_TEXT)
+        {
+            printf("Trace file problem: malformed record on line %lu\n", trace.getLineNum());
+        }
+        else
+        {
+            printf("Trace file problem: truncated or corrupt binary trace\n");
+        }
+        fclose(pFile);
+        remove(outName);
+        exit(0);
+    }
+
+    long outBytes = ftell(pFile);
+    ok = ok && (fseek(pFile, 0, SEEK_SET) == 0);
+    ok = ok && (fwrite(&header, sizeof(header), 1, pFile) == 1);
+    ok = (fclose(pFile) == 0) && ok;
+
+    if(!ok)
+    {
+        printf("Output file problem\n");
+        remove(outName);
+        exit(0);
+    }
+
+    printf("Converted %lu records (%u processors) from %s to %s\n", header.numRecords, header.numProcessors, inName, outName);
+    printf("Output size: %ld bytes (%.2f bytes/record)\n", outBytes, header.numRecords ? (double)outBytes/header.numRecords : 0.0);
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * \file trace_format.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Binary Trace File Format
+ *
+ * A binary trace is a traceFileHeader followed by numRecords records. The
+ * fixed width encoding stores every record exactly as the in-memory
+ * traceRecord, so loading is a memory copy. The delta encoding groups
+ * records into independently decodable blocks, each a traceBlockHeader and
+ * a payload of varints: (procNum << 1 | rdWr), then the zig-zag mapped
+ * difference to the previous address of the same processor within the
+ * block. All fields are host byte order.
+ */
+
+#ifndef __TRACE_FORMAT_H__
+#define __TRACE_FORMAT_H__
+
+#include "trace_reader.h"
+
+/** Magic Bytes at the Start of Every Binary Trace */
+#define TRACE_MAGIC "SMPTRACE"
+
+/** Length of the Magic Bytes */
+#define TRACE_MAGIC_LEN 8
+
+/** Current Binary Trace Format Version */
+#define TRACE_VERSION 1
+
+/** Record Encoding Enumeration */
+enum traceEncoding  {
+                        TRACE_ENC_FIXED = 0,    /**< Fixed Width traceRecord Array */
+                        TRACE_ENC_DELTA = 1     /**< Blocks of Per Processor Zig-Zag Varint Address Deltas */
+};
+
+/** Most Processors a Binary Trace May Declare, the Delta Decoder Keeps an Address per Processor */
+#define TRACE_MAX_PROCESSORS (1U << 20)
+
+/** Records per Block Written by the Delta Encoder */
+#define TRACE_BLOCK_RECORDS 65536
+
+/** Longest Varint Encoding of a 64 Bit Value */
+#define VARINT_MAX_LEN 10
+
+/**
+ * \struct traceFileHeader
+ * \brief Header of a Binary Trace File
+ */
+struct traceFileHeader
+{
+    char magic[TRACE_MAGIC_LEN];    /**< TRACE_MAGIC, Not NUL Terminated */
+    uint version;                   /**< Format Version, TRACE_VERSION */
+    uint encoding;                  /**< Record Encoding, see traceEncoding */
+    ulong numRecords;               /**< Number of Records in the File */
+    uint numProcessors;             /**< Highest Processor Number Plus One */
+    uint recordSize;                /**< Size of One Fixed Width Record in Bytes, 0 for Delta */
+};
+
+/**
+ * \struct traceBlockHeader
+ * \brief Header of One Block of a Delta Encoded Trace
+ */
+struct traceBlockHeader
+{
+    uint numRecords;                /**< Records Encoded in the Block */
+    uint payloadBytes;              /**< Length of the Varint Payload Following this Header */
+};
+
+/**
+ * \brief Zig-Zag Map a Signed Delta onto an Unsigned Value
+ * \param[in] v Signed Delta
+ * \return Small Magnitudes of Either Sign Map to Small Values
+ */
+inline ulong zigzagEncode(long v)
+{
+    return ((ulong)v << 1) ^ (ulong)(v >> 63);
+}
+
+/**
+ * \brief Undo zigzagEncode
+ * \param[in] v Zig-Zag Mapped Value
+ * \return Signed Delta
+ */
+inline long zigzagDecode(ulong v)
+{
+    return (long)(v >> 1) ^ -(long)(v & 1);
+}
+
+/**
+ * \brief Append a Varint (7 Bits per Byte, Least Significant Group First)
+ * \param[out] p Output Position, Needs Room for VARINT_MAX_LEN Bytes
+ * \param[in] v Value to Encode
+ * \return Position After the Encoded Value
+ */
+inline uchar *putVarint(uchar *p, ulong v)
+{
+    while(v >= 0x80)
+    {
+        *p++ = (uchar)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uchar)v;
+
+    return p;
+}
+
+#endif
@@ -0,0 +1,462 @@
+/**
+ * \file trace_reader.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Memory Mapped Trace Reader
+ */
+
+#include "trace_reader.h"
+#include "trace_format.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/** Marker for Characters that are not Digits */
+#define NOT_DIGIT 0xFF
+
+/** Character Class Tables Used by the Decoder */
+static uchar hexDigit[256];     /**< Hex Value of a Character or NOT_DIGIT */
+static uchar decDigit[256];     /**< Decimal Value of a Character or NOT_DIGIT */
+static uchar isSpace[256];      /**< Whether a Character is Blank Space */
+static uchar isBlank[256];      /**< Whether a Character is a Space or Tab, the Separators Within a Line */
+
+/**
+ * \brief Build the Character Class Tables
+ * \return Always True
+ */
+static bool buildTables()
+{
+    uint c;
+    for(c=0; c<256; c++)
+    {
+        hexDigit[c] = NOT_DIGIT;
+        decDigit[c] = NOT_DIGIT;
+        isSpace[c] = 0;
+        isBlank[c] = 0;
+    }
+    for(c='0'; c<='9'; c++)
+    {
+        hexDigit[c] = (uchar)(c-'0');
+        decDigit[c] = (uchar)(c-'0');
+    }
+    for(c='a'; c<='f'; c++)
+    {
+        hexDigit[c] = (uchar)(c-'a'+10);
+        hexDigit[c-'a'+'A'] = (uchar)(c-'a'+10);
+    }
+    isSpace[(uchar)' '] = isSpace[(uchar)'\t'] = isSpace[(uchar)'\r'] = 1;
+    isSpace[(uchar)'\n'] = isSpace[(uchar)'\v'] = isSpace[(uchar)'\f'] = 1;
+    isBlank[(uchar)' '] = isBlank[(uchar)'\t'] = 1;
+
+    return true;
+}
+
+static bool tablesBuilt = buildTables();
+
+traceReader::traceReader()
+{
+    base = cur = end = NULL;
+    mapSize = 0;
+    lineNum = 1;
+    error = false;
+    format = TRACE_FILE_TEXT;
+    numRecords = 0;
+    numProcessors = 0;
+    encoding = TRACE_ENC_FIXED;
+    numDecoded = 0;
+    blockLeft = 0;
+    blockEnd = NULL;
+    prevAddr = NULL;
+    procLimit = 1UL << 32;
+}
+
+bool traceReader::open(const char *fname)
+{
+    struct stat st;
+
+    close();
+
+    int fd = ::open(fname, O_RDONLY);
+    if(fd < 0)
+    {
+        return false;
+    }
+
+    if(fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    /** An Empty Trace is Valid but Cannot be Mapped */
+    mapSize = (size_t)st.st_size;
+    if(mapSize > 0)
+    {
+        void *map = mmap(NULL, mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(map == MAP_FAILED)
+        {
+            ::close(fd);
+            mapSize = 0;
+            return false;
+        }
+        madvise(map, mapSize, MADV_SEQUENTIAL);
+        base = (const char *)map;
+    }
+    ::close(fd);
+
+    cur = base;
+    end = base + mapSize;
+    lineNum = 1;
+    error = false;
+    format = TRACE_FILE_TEXT;
+    numRecords = 0;
+    numProcessors = 0;
+    encoding = TRACE_ENC_FIXED;
+    numDecoded = 0;
+    blockLeft = 0;
+    blockEnd = NULL;
+
+    /** Binary Traces Start with the Magic Bytes, Anything Else is Text */
+    if((mapSize >= TRACE_MAGIC_LEN) && (memcmp(base, TRACE_MAGIC, TRACE_MAGIC_LEN) == 0))
+    {
+        traceFileHeader header;
+        if(mapSize < sizeof(header))
+        {
+            close();
+            return false;
+        }
+        memcpy(&header, base, sizeof(header));
+
+        /** The Processor Count Sizes an Allocation, Check it Before Trusting it */
+        if((header.version != TRACE_VERSION) || (header.numProcessors > TRACE_MAX_PROCESSORS))
+        {
+            close();
+            return false;
+        }
+
+        switch(header.encoding)
+        {
+            case TRACE_ENC_FIXED:   if((header.recordSize != sizeof(traceRecord)) || (header.numRecords > (mapSize - sizeof(header))/sizeof(traceRecord)))
+                                    {
+                                        close();
+                                        return false;
+                                    }
+                                    end = base + sizeof(header) + header.numRecords*sizeof(traceRecord);
+                                    break;
+
+            case TRACE_ENC_DELTA:   if((header.numProcessors == 0) && (header.numRecords > 0))
+                                    {
+                                        close();
+                                        return false;
+                                    }
+                                    prevAddr = new ulong[header.numProcessors + 1];
+                                    break;
+
+            default:    close();
+                        return false;
+        }
+
+        format = TRACE_FILE_BINARY;
+        encoding = header.encoding;
+        numRecords = header.numRecords;
+        numProcessors = header.numProcessors;
+        cur = base + sizeof(header);
+    }
+
+    return tablesBuilt;
+}
+
+void traceReader::close()
+{
+    if(base != NULL)
+    {
+        munmap((void *)base, mapSize);
+    }
+    base = cur = end = NULL;
+    mapSize = 0;
+
+    delete [] prevAddr;
+    prevAddr = NULL;
+}
+
+ulong traceReader::nextBatch(traceRecord *batch, ulong maxRecords)
+{
+    ulong n;
+
+    if(format == TRACE_FILE_TEXT)
+    {
+        n = decodeText(batch, maxRecords);
+    }
+    else if(encoding == TRACE_ENC_DELTA)
+    {
+        n = decodeDelta(batch, maxRecords);
+    }
+    else
+    {
+        n = copyFixed(batch, maxRecords);
+    }
+    numDecoded += n;
+
+    /** A Binary Trace Ending Short of its Declared Length is Truncated */
+    if((n == 0) && (format == TRACE_FILE_BINARY) && (numDecoded != numRecords))
+    {
+        error = true;
+    }
+
+    return n;
+}
+
+bool traceReader::readAll(std::vector<traceRecord> &records)
+{
+    ulong n;
+
+    if(numRecords > numDecoded)
+    {
+        records.reserve(records.size() + (numRecords - numDecoded));
+    }
+
+    do
+    {
+        ulong used = records.size();
+        records.resize(used + TRACE_BATCH);
+        n = nextBatch(&records[used], TRACE_BATCH);
+        records.resize(used + n);
+    } while(n > 0);
+
+    return !error;
+}
+
+/**
+ * \brief Read One Varint, Bounds Checked Against the Block Payload
+ * \param[in,out] p Read Position, Advanced Past the Value
+ * \param[in] e End of the Block Payload
+ * \param[out] v Decoded Value
+ * \return Whether a Complete Value was Read
+ */
+static inline bool getVarint(const uchar *&p, const uchar *e, ulong &v)
+{
+    ulong shift = 0;
+    v = 0;
+    while(p < e)
+    {
+        uchar b = *p++;
+        v |= (ulong)(b & 0x7F) << shift;
+        if(b < 0x80)
+        {
+            return true;
+        }
+        shift += 7;
+        if(shift >= 64)
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+ulong traceReader::decodeDelta(traceRecord *batch, ulong maxRecords)
+{
+    const uchar *p = (const uchar *)cur;
+    const uchar *e = (const uchar *)end;
+    const uchar *be = (const uchar *)blockEnd;
+    ulong n = 0;
+
+    if(error)
+    {
+        return 0;
+    }
+
+    while(n < maxRecords)
+    {
+        /** Open the Next Block, Deltas Restart From Zero in Every Block */
+        if(blockLeft == 0)
+        {
+            if((be != NULL) && (p != be))
+            {
+                error = true;
+                break;
+            }
+            if(p == e)
+            {
+                break;
+            }
+
+            traceBlockHeader block;
+            if((ulong)(e - p) < sizeof(block))
+            {
+                error = true;
+                break;
+            }
+            memcpy(&block, p, sizeof(block));
+            p += sizeof(block);
+            if(block.payloadBytes > (ulong)(e - p))
+            {
+                error = true;
+                break;
+            }
+
+            be = p + block.payloadBytes;
+            blockLeft = block.numRecords;
+            memset(prevAddr, 0, numProcessors*sizeof(ulong));
+            continue;
+        }
+
+        ulong take = blockLeft < (maxRecords - n) ? blockLeft : (maxRecords - n);
+        ulong loop_r;
+        for(loop_r=0; loop_r<take; loop_r++)
+        {
+            ulong key, delta;
+            if(!getVarint(p, be, key) || !getVarint(p, be, delta) || ((key >> 1) >= numProcessors))
+            {
+                error = true;
+                break;
+            }
+
+            ulong procNum = key >> 1;
+            ulong addr = prevAddr[procNum] + (ulong)zigzagDecode(delta);
+            prevAddr[procNum] = addr;
+
+            batch[n].addr = addr;
+            batch[n].procNum = (uint)procNum;
+            batch[n].rdWr = (uchar)(key & 1);
+            n++;
+        }
+        if(error)
+        {
+            break;
+        }
+        blockLeft -= take;
+    }
+
+    cur = (const char *)p;
+    blockEnd = (const char *)be;
+
+    return n;
+}
+
+ulong traceReader::copyFixed(traceRecord *batch, ulong maxRecords)
+{
+    ulong n = (ulong)(end - cur)/sizeof(traceRecord);
+    if(n > maxRecords)
+    {
+        n = maxRecords;
+    }
+
+    if(error)
+    {
+        return 0;
+    }
+
+    memcpy(batch, cur, n*sizeof(traceRecord));
+
+    /** A Record Naming a Processor Past the Header's Count Would Index Past the Caches */
+    uint maxProc = 0;
+    ulong loop_r;
+    for(loop_r=0; loop_r<n; loop_r++)
+    {
+        maxProc = (batch[loop_r].procNum > maxProc) ? batch[loop_r].procNum : maxProc;
+    }
+    if((n > 0) && (maxProc >= numProcessors))
+    {
+        error = true;
+        return 0;
+    }
+    cur += n*sizeof(traceRecord);
+
+    return n;
+}
+
+ulong traceReader::decodeText(traceRecord *batch, ulong maxRecords)
+{
+    const uchar *p = (const uchar *)cur;
+    const uchar *e = (const uchar *)end;
+    ulong n = 0;
+
+    if(error)
+    {
+        return 0;
+    }
+
+    while(n < maxRecords)
+    {
+        /** Skip Blank Space and Empty Lines */
+        while((p < e) && isSpace[*p])
+        {
+            lineNum += (*p == '\n');
+            p++;
+        }
+
+        if(p == e)
+        {
+            break;
+        }
+
+        /** Processor Number, Checked as it Grows so it Can Neither Wrap Nor Index Past the Caches */
+        ulong procNum = 0;
+        const uchar *start = p;
+        uchar d;
+        while((p < e) && ((d = decDigit[*p]) != NOT_DIGIT) && (procNum < procLimit))
+        {
+            procNum = procNum*10 + d;
+            p++;
+        }
+        if((p == start) || (procNum >= procLimit))
+        {
+            error = true;
+            break;
+        }
+
+        /** Fields are Separated Within the Line, a Record Never Continues on the Next */
+        while((p < e) && isBlank[*p])
+        {
+            p++;
+        }
+
+        /** Access Type, Only the First Character of the Field Matters */
+        if((p == e) || isSpace[*p])
+        {
+            error = true;
+            break;
+        }
+        uchar rdWr = (uchar)(*p == 'w');
+        while((p < e) && !isSpace[*p])
+        {
+            p++;
+        }
+
+        while((p < e) && isBlank[*p])
+        {
+            p++;
+        }
+
+        /** Hex Address with Optional 0x Prefix */
+        if(((e - p) > 2) && (p[0] == '0') && ((p[1] | 0x20) == 'x') && (hexDigit[p[2]] != NOT_DIGIT))
+        {
+            p += 2;
+        }
+        ulong addr = 0;
+        start = p;
+        while((p < e) && ((d = hexDigit[*p]) != NOT_DIGIT))
+        {
+            addr = (addr << 4) | d;
+            p++;
+        }
+        if(p == start)
+        {
+            error = true;
+            break;
+        }
+
+        batch[n].addr = addr;
+        batch[n].procNum = (uint)procNum;
+        batch[n].rdWr = rdWr;
+        n++;
+    }
+
+    cur = (const char *)p;
+
+    return n;
+}
@@ -0,0 +1,193 @@
+/**
+ * \file trace_reader.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Memory Mapped Trace Reader
+ */
+
+#ifndef __TRACE_READER_H__
+#define __TRACE_READER_H__
+
+#include <stddef.h>
+#include <vector>
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/** Type define unsigned char as uchar */
+typedef unsigned char uchar;
+
+/** Type define unsigned int as uint */
+typedef unsigned int uint;
+
+/** Number of Records Decoded per Batch by Default */
+#define TRACE_BATCH 4096
+
+/**
+ * \struct traceRecord
+ * \brief One Decoded Memory Reference of the Input Trace
+ */
+struct traceRecord
+{
+    ulong addr;         /**< Address the Processor is Requesting */
+    uint procNum;       /**< Processor Requesting the Address */
+    uchar rdWr;         /**< Type of Request (0: Read, 1: Write) */
+};
+
+/** Trace File Format Enumeration */
+enum traceFileFormat    {
+                            TRACE_FILE_TEXT =   0,  /**< One "<processor> <r|w> <hex address>" per Line */
+                            TRACE_FILE_BINARY = 1   /**< Binary Trace, see trace_format.h */
+};
+
+/**
+ * \class traceReader
+ * \brief Class for a Memory Mapped Trace Reader
+ *
+ * The trace file is mapped read only and its format detected from the
+ * leading magic bytes. Text traces are decoded in place, each line being
+ * "<processor> <r|w> <hex address>"; fixed width binary traces are copied
+ * out as is and delta encoded ones are decoded one block at a time.
+ * Records are handed out in batches so the caller never touches the raw file.
+ */
+class traceReader
+{
+protected:
+    const char *base;       /**< Start of the Mapped Trace File */
+    const char *cur;        /**< Current Decode Position */
+    const char *end;        /**< End of the Mapped Trace File */
+    size_t mapSize;         /**< Size of the Mapping in Bytes */
+    ulong lineNum;          /**< Line Number of the Record Being Decoded */
+    bool error;             /**< Malformed Record Encountered */
+    enum traceFileFormat format;    /**< Format of the Mapped File */
+    ulong numRecords;       /**< Records in a Binary Trace, 0 if Unknown */
+    uint numProcessors;     /**< Processors in a Binary Trace, 0 if Unknown */
+    uint encoding;          /**< Record Encoding of a Binary Trace */
+    ulong numDecoded;       /**< Records Handed Out So Far */
+    ulong blockLeft;        /**< Records Left in the Current Delta Block */
+    const char *blockEnd;   /**< End of the Current Delta Block Payload */
+    ulong *prevAddr;        /**< Previous Address per Processor in the Current Delta Block */
+    ulong procLimit;        /**< Processor Numbers a Text Trace May Name, Higher Ones are Malformed */
+
+    /**
+     * \brief Decode the Next Batch of Records from a Text Trace
+     * \param[out] batch Record Buffer to Fill
+     * \param[in] maxRecords Capacity of the Record Buffer
+     * \return Number of Records Decoded
+     */
+    ulong decodeText(traceRecord *batch, ulong maxRecords);
+
+    /**
+     * \brief Copy the Next Batch of Records from a Fixed Width Binary Trace
+     * \param[out] batch Record Buffer to Fill
+     * \param[in] maxRecords Capacity of the Record Buffer
+     * \return Number of Records Copied
+     */
+    ulong copyFixed(traceRecord *batch, ulong maxRecords);
+
+    /**
+     * \brief Decode the Next Batch of Records from a Delta Encoded Binary Trace
+     * \param[out] batch Record Buffer to Fill
+     * \param[in] maxRecords Capacity of the Record Buffer
+     * \return Number of Records Decoded
+     */
+    ulong decodeDelta(traceRecord *batch, ulong maxRecords);
+
+public:
+
+    /**
+     * \brief traceReader Class Constructor
+     */
+    traceReader();
+
+    /**
+     * \brief traceReader Class Destructor
+     */
+    ~traceReader()
+    {
+        close();
+    }
+
+    /**
+     * \brief Map a Trace File
+     * \param[in] fname Trace File Name
+     * \return Whether the File was Opened, Mapped and has a Valid Header
+     */
+    bool open(const char *fname);
+
+    /**
+     * \brief Unmap and Close the Trace File
+     */
+    void close();
+
+    /**
+     * \brief Bound the Processor Numbers of a Text Trace, Binary Traces Declare Theirs
+     * \param[in] numP Number of Processors Simulated
+     */
+    void setProcessorLimit(ulong numP)
+    {
+        procLimit = numP;
+    }
+
+    /**
+     * \brief Decode the Next Batch of Records
+     * \param[out] batch Record Buffer to Fill
+     * \param[in] maxRecords Capacity of the Record Buffer
+     * \return Number of Records Decoded, 0 at End of Trace or on Error
+     */
+    ulong nextBatch(traceRecord *batch, ulong maxRecords);
+
+    /**
+     * \brief Decode the Rest of the Trace into One Buffer
+     * \param[out] records Decoded Records, Appended in Trace Order
+     * \return Whether the Trace Decoded Without Error
+     */
+    bool readAll(std::vector<traceRecord> &records);
+
+    /**
+     * \brief Malformed Record Check
+     * \return Whether Decoding Stopped on a Malformed Record
+     */
+    bool hasError()
+    {
+        return error;
+    }
+
+    /**
+     * \brief Get Format of the Mapped File
+     * \return Trace File Format
+     */
+    enum traceFileFormat getFormat()
+    {
+        return format;
+    }
+
+    /**
+     * \brief Get Number of Records Declared by a Binary Trace Header
+     * \return Number of Records, 0 if Unknown
+     */
+    ulong getNumRecords()
+    {
+        return numRecords;
+    }
+
+    /**
+     * \brief Get Number of Processors Declared by a Binary Trace Header
+     * \return Number of Processors, 0 if Unknown
+     */
+    uint getNumProcessors()
+    {
+        return numProcessors;
+    }
+
+    /**
+     * \brief Get Line Number of the Last Decoded Record
+     * \return Line Number (1 Based)
+     */
+    ulong getLineNum()
+    {
+        return lineNum;
+    }
+};
+
+#endif
@@ -0,0 +1,36 @@
+/**
+ * \file zero_pages.cc
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Source: Lazily Committed, Zero Filled Allocations
+ */
+
+#include "zero_pages.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+void *allocZeroPages(ulong bytes)
+{
+    if(bytes == 0)
+    {
+        return NULL;
+    }
+
+    void *pages = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if(pages == MAP_FAILED)
+    {
+        printf("MEMORY: could not map %lu bytes\n", bytes);
+        exit(0);
+    }
+
+    return pages;
+}
+
+void freeZeroPages(void *pages, ulong bytes)
+{
+    if(pages != NULL)
+    {
+        munmap(pages, bytes);
+    }
+}
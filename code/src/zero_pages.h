@@ -0,0 +1,79 @@
+/**
+ * \file zero_pages.h
+ * \author Soumil Krishnanand Heble
+ * \date 10/16/2026
+ * \brief Header: Lazily Committed, Zero Filled Allocations
+ */
+
+#ifndef __ZERO_PAGES_H__
+#define __ZERO_PAGES_H__
+
+/** Type define unsigned long as ulong */
+typedef unsigned long ulong;
+
+/**
+ * \brief Allocate Zero Filled Anonymous Pages
+ *
+ * The pages are only committed when first touched, so the cost of a large
+ * array is O(1) at allocation and grows with the part of it that is used.
+ * The memory is page aligned, so also aligned to a host cache line.
+ *
+ * \param[in] bytes Size in Bytes
+ * \return Pages, NULL for 0 Bytes, Exits if the Mapping Fails
+ */
+void *allocZeroPages(ulong bytes);
+
+/**
+ * \brief Release Pages from allocZeroPages
+ * \param[in] pages Pages, NULL is Ignored
+ * \param[in] bytes Size Passed to allocZeroPages
+ */
+void freeZeroPages(void *pages, ulong bytes);
+
+/**
+ * \class zeroArray
+ * \brief Fixed Size Array Backed by allocZeroPages, Every Element Starts as All Zero Bits
+ */
+template <typename T>
+class zeroArray
+{
+protected:
+    T *data;                    /**< Elements */
+    ulong count;                /**< Number of Elements */
+
+    /** Not Copyable, the Pages are Owned */
+    zeroArray(const zeroArray &);
+    zeroArray &operator=(const zeroArray &);
+
+public:
+
+    /**
+     * \brief zeroArray Class Constructor
+     * \param[in] n Number of Elements
+     */
+    zeroArray(ulong n)
+    {
+        count = n;
+        data = (T *)allocZeroPages(n*sizeof(T));
+    }
+
+    /**
+     * \brief zeroArray Class Destructor
+     */
+    ~zeroArray()
+    {
+        freeZeroPages(data, count*sizeof(T));
+    }
+
+    /**
+     * \brief Element Access
+     * \param[in] i Index
+     * \return Element i
+     */
+    T &operator[](ulong i)
+    {
+        return data[i];
+    }
+};
+
+#endif